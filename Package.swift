@@ -19,6 +19,7 @@ func isTargetingDarwin() -> Bool {
 }
 
 let buildTests = false
+let buildBenchmarks = false
 let targetsDarwin = isTargetingDarwin()
 
 extension Product {
@@ -30,6 +31,14 @@ extension Product {
         }
     }
 
+    static func benchmarks() -> [Product] {
+        if buildBenchmarks {
+            [.executable(name: "RxBenchmarks", targets: ["RxBenchmarks"])]
+        } else {
+            []
+        }
+    }
+
     static func rxCocoaProducts() -> [Product] {
         if targetsDarwin {
             [
@@ -92,6 +101,21 @@ extension Target {
             []
         }
     }
+
+    static func benchmarks() -> [Target] {
+        if buildBenchmarks {
+            [
+                .target(name: "RxMallocCounter", path: "Tests/Benchmarks/RxMallocCounter"),
+                .executableTarget(
+                    name: "RxBenchmarks",
+                    dependencies: ["RxSwift", "RxRelay", "RxMallocCounter"],
+                    path: "Tests/Benchmarks/RxBenchmarks"
+                )
+            ]
+        } else {
+            []
+        }
+    }
 }
 
 let package = Package(
@@ -109,7 +133,8 @@ let package = Package(
             .library(name: "RxTest-Dynamic", type: .dynamic, targets: ["RxTest"])
         ],
         Product.rxCocoaProducts(),
-        Product.allTests()
+        Product.allTests(),
+        Product.benchmarks()
     ] as [[Product]]).flatMap(\.self),
     targets: ([
         [
@@ -122,7 +147,8 @@ let package = Package(
             .target(name: "RxBlocking", dependencies: ["RxSwift"]),
             .target(name: "RxTest", dependencies: ["RxSwift"])
         ],
-        Target.allTests()
+        Target.allTests(),
+        Target.benchmarks()
     ] as [[Target]]).flatMap(\.self),
     swiftLanguageVersions: [.v5]
 )
@@ -6,13 +6,58 @@
 //  Copyright © 2018 Krunoslav Zaher. All rights reserved.
 //
 
+#if compiler(>=6.0) && canImport(Synchronization) && !canImport(Darwin)
+import Synchronization
+
+// `Atomic` has no availability restrictions outside of Darwin, so on Linux (and other
+// non-Darwin platforms) the counter is a single hardware-atomic word stored inline.
+// Lock acquire/release semantics are preserved by using acquiring loads and
+// acquiring-and-releasing read-modify-write operations.
+//
+// The class isn't final so that objects that need exactly one atomic word (e.g. `SinkDisposer`)
+// can inherit it and save an allocation.
+class AtomicInt: @unchecked Sendable {
+    fileprivate let value: Atomic<Int32>
+    init(_ value: Int32 = 0) {
+        self.value = Atomic(value)
+    }
+}
+
+@discardableResult
+@inline(__always)
+func add(_ this: AtomicInt, _ value: Int32) -> Int32 {
+    this.value.wrappingAdd(value, ordering: .acquiringAndReleasing).oldValue
+}
+
+@discardableResult
+@inline(__always)
+func sub(_ this: AtomicInt, _ value: Int32) -> Int32 {
+    this.value.wrappingSubtract(value, ordering: .acquiringAndReleasing).oldValue
+}
+
+@discardableResult
+@inline(__always)
+func fetchOr(_ this: AtomicInt, _ mask: Int32) -> Int32 {
+    this.value.bitwiseOr(mask, ordering: .acquiringAndReleasing).oldValue
+}
+
+@inline(__always)
+func load(_ this: AtomicInt) -> Int32 {
+    this.value.load(ordering: .acquiring)
+}
+#else
 import CoreFoundation
 
 // This CoreFoundation import can be dropped when this issue is resolved:
 // https://github.com/swiftlang/swift-corelibs-foundation/pull/5122
 import Foundation
 
-final class AtomicInt: NSLock, @unchecked Sendable {
+// `Synchronization.Atomic` requires iOS 18 / macOS 15 on Darwin, which is above the deployment
+// target, so Darwin (and older toolchains) keep the lock based implementation.
+//
+// The class isn't final so that objects that need exactly one atomic word (e.g. `SinkDisposer`)
+// can inherit it and save an allocation.
+class AtomicInt: NSLock, @unchecked Sendable {
     fileprivate var value: Int32
     init(_ value: Int32 = 0) {
         self.value = value
@@ -56,6 +101,7 @@ func load(_ this: AtomicInt) -> Int32 {
     this.unlock()
     return oldValue
 }
+#endif
 
 @discardableResult
 @inline(__always)
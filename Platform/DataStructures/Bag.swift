@@ -8,7 +8,8 @@
 
 import Swift
 
-let arrayDictionaryMaxSize = 30
+/// Removed entries are compacted away once there are more of them than this and than live entries.
+let bagCompactionThreshold = 16
 
 struct BagKey {
     /**
@@ -16,8 +17,14 @@ struct BagKey {
 
      It's underlying type is UInt64. If we assume there in an idealized CPU that works at 4GHz,
       it would take ~150 years of continuous running time for it to overflow.
+
+     Slots are reused, so this also serves as the slot generation: a key only matches
+     a slot while the slot still holds the element the key was issued for.
      */
     fileprivate let rawValue: UInt64
+
+    /// Index of the slot that holds the element.
+    fileprivate let slot: Int
 }
 
 /**
@@ -25,17 +32,24 @@ struct BagKey {
 
  Single element can be stored multiple times.
 
- Time and space complexity of insertion and deletion is O(n).
+ It is a generational slot map: keys index a slot table that points into dense storage kept in
+ insertion order. Insertion and deletion are O(1) (amortized), enumeration walks contiguous storage
+ in insertion order and freed slots and capacity are reused.
 
- It is suitable for storing small number of elements.
+ First element is stored inline, which is the common case for subscriptions.
  */
 struct Bag<T>: CustomDebugStringConvertible {
     /// Type of identifier for inserted elements.
     typealias KeyType = BagKey
 
-    typealias Entry = (key: BagKey, value: T)
+    struct Slot {
+        /// Key of the element stored in this slot.
+        var rawValue: UInt64
+        /// Position of the element in dense storage, `-1` when the slot is free.
+        var index: Int
+    }
 
-    private var _nextKey: BagKey = .init(rawValue: 0)
+    private var _nextKey: UInt64 = 0
 
     // data
 
@@ -43,11 +57,15 @@ struct Bag<T>: CustomDebugStringConvertible {
     var _key0: BagKey?
     var _value0: T?
 
-    // then fill "array dictionary"
-    var _pairs = ContiguousArray<Entry>()
+    // then dense storage in insertion order, `nil` marks removed elements until the next compaction
+    var _values = ContiguousArray<T?>()
+    private var _valueSlots = ContiguousArray<Int>()
+
+    // slot table that keys point into
+    private var _slots = ContiguousArray<Slot>()
+    private var _freeSlots = ContiguousArray<Int>()
 
-    // last is sparse dictionary
-    var _dictionary: [BagKey: T]?
+    private var _denseCount = 0
 
     var _onlyFastPath = true
 
@@ -61,37 +79,47 @@ struct Bag<T>: CustomDebugStringConvertible {
      - returns: Key that can be used to remove element from bag.
      */
     mutating func insert(_ element: T) -> BagKey {
-        let key = _nextKey
+        let rawValue = _nextKey
 
-        _nextKey = BagKey(rawValue: _nextKey.rawValue &+ 1)
+        _nextKey = _nextKey &+ 1
 
-        if _key0 == nil {
-            _key0 = key
-            _value0 = element
-            return key
-        }
-
-        _onlyFastPath = false
+        if _onlyFastPath {
+            guard let key0 = _key0, let value0 = _value0 else {
+                let key = BagKey(rawValue: rawValue, slot: 0)
+                _key0 = key
+                _value0 = element
+                return key
+            }
 
-        if _dictionary != nil {
-            _dictionary![key] = element
-            return key
+            // Moves the inline element into slot 0 so it keeps both its key and its position.
+            _onlyFastPath = false
+            _key0 = nil
+            _value0 = nil
+            _slots.append(Slot(rawValue: key0.rawValue, index: 0))
+            _values.append(value0)
+            _valueSlots.append(0)
+            _denseCount = 1
         }
 
-        if _pairs.count < arrayDictionaryMaxSize {
-            _pairs.append((key: key, value: element))
-            return key
+        let slot: Int
+        if let freeSlot = _freeSlots.popLast() {
+            slot = freeSlot
+            _slots[slot] = Slot(rawValue: rawValue, index: _values.count)
+        } else {
+            slot = _slots.count
+            _slots.append(Slot(rawValue: rawValue, index: _values.count))
         }
 
-        _dictionary = [key: element]
+        _values.append(element)
+        _valueSlots.append(slot)
+        _denseCount += 1
 
-        return key
+        return BagKey(rawValue: rawValue, slot: slot)
     }
 
     /// - returns: Number of elements in bag.
     var count: Int {
-        let dictionaryCount: Int = _dictionary?.count ?? 0
-        return (_value0 != nil ? 1 : 0) + _pairs.count + dictionaryCount
+        _onlyFastPath ? (_value0 != nil ? 1 : 0) : _denseCount
     }
 
     /// Removes all elements from bag and clears capacity.
@@ -99,8 +127,12 @@ struct Bag<T>: CustomDebugStringConvertible {
         _key0 = nil
         _value0 = nil
 
-        _pairs.removeAll(keepingCapacity: false)
-        _dictionary?.removeAll(keepingCapacity: false)
+        _values.removeAll(keepingCapacity: false)
+        _valueSlots.removeAll(keepingCapacity: false)
+        _slots.removeAll(keepingCapacity: false)
+        _freeSlots.removeAll(keepingCapacity: false)
+        _denseCount = 0
+        _onlyFastPath = true
     }
 
     /**
@@ -110,24 +142,64 @@ struct Bag<T>: CustomDebugStringConvertible {
      - returns: Element that bag contained, or nil in case element was already removed.
      */
     mutating func removeKey(_ key: BagKey) -> T? {
-        if _key0 == key {
+        if _onlyFastPath {
+            guard _key0 == key else {
+                return nil
+            }
             _key0 = nil
             let value = _value0!
             _value0 = nil
             return value
         }
 
-        if let existingObject = _dictionary?.removeValue(forKey: key) {
-            return existingObject
+        guard key.slot < _slots.count else {
+            return nil
         }
 
-        for i in 0 ..< _pairs.count where _pairs[i].key == key {
-            let value = _pairs[i].value
-            _pairs.remove(at: i)
-            return value
+        let slot = _slots[key.slot]
+        guard slot.index >= 0, slot.rawValue == key.rawValue else {
+            return nil
         }
 
-        return nil
+        let value = _values[slot.index]
+        _values[slot.index] = nil
+        _slots[key.slot].index = -1
+        _freeSlots.append(key.slot)
+        _denseCount -= 1
+
+        trimRemoved()
+
+        return value
+    }
+
+    private mutating func trimRemoved() {
+        // removing from the end is common (last subscriber unsubscribes first), so it's free
+        while let last = _values.last, last == nil {
+            _values.removeLast()
+            _valueSlots.removeLast()
+        }
+
+        let removedCount = _values.count - _denseCount
+        if removedCount > bagCompactionThreshold, removedCount > _denseCount {
+            compact()
+        }
+    }
+
+    private mutating func compact() {
+        var target = 0
+        for index in 0 ..< _values.count {
+            guard let value = _values[index] else {
+                continue
+            }
+            let slot = _valueSlots[index]
+            _values[target] = value
+            _valueSlots[target] = slot
+            _slots[slot].index = target
+            target += 1
+        }
+
+        _values.removeSubrange(target...)
+        _valueSlots.removeSubrange(target...)
     }
 }
 
@@ -139,7 +211,7 @@ extension Bag {
 }
 
 extension Bag {
-    /// Enumerates elements inside the bag.
+    /// Enumerates elements inside the bag in insertion order.
     ///
     /// - parameter action: Enumeration closure.
     func forEach(_ action: (T) -> Void) {
@@ -150,20 +222,11 @@ extension Bag {
             return
         }
 
-        let value0 = _value0
-        let dictionary = _dictionary
-
-        if let value0 {
-            action(value0)
-        }
-
-        for i in 0 ..< _pairs.count {
-            action(_pairs[i].value)
-        }
+        let values = _values
 
-        if dictionary?.count ?? 0 > 0 {
-            for element in dictionary!.values {
-                action(element)
+        for i in 0 ..< values.count {
+            if let value = values[i] {
+                action(value)
             }
         }
     }
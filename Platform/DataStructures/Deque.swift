@@ -0,0 +1,99 @@
+//
+//  Deque.swift
+//  Platform
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/**
+ Data structure that represents double-ended queue.
+
+ Complexity of `pushBack`, `popBack` and `popFront` is O(1) when number of operations is
+ averaged over N operations.
+ */
+struct Deque<T> {
+    private let resizeFactor = 2
+
+    private var storage: ContiguousArray<T?>
+    private var headIndex = 0
+    private var innerCount = 0
+
+    /**
+     Creates new deque.
+
+     - parameter capacity: Capacity of newly created deque.
+     */
+    init(capacity: Int) {
+        storage = ContiguousArray<T?>(repeating: nil, count: Swift.max(capacity, 1))
+    }
+
+    /// - returns: Is deque empty.
+    var isEmpty: Bool { innerCount == 0 }
+
+    /// - returns: Number of elements inside deque.
+    var count: Int { innerCount }
+
+    private func storageIndex(_ offset: Int) -> Int {
+        let index = headIndex + offset
+        return index >= storage.count ? index - storage.count : index
+    }
+
+    private mutating func resizeTo(_ size: Int) {
+        var newStorage = ContiguousArray<T?>(repeating: nil, count: size)
+
+        for offset in 0 ..< innerCount {
+            newStorage[offset] = storage[storageIndex(offset)]
+        }
+
+        headIndex = 0
+        storage = newStorage
+    }
+
+    /// Appends `element` to the back.
+    ///
+    /// - parameter element: Element to append.
+    mutating func pushBack(_ element: T) {
+        if innerCount == storage.count {
+            resizeTo(storage.count * resizeFactor)
+        }
+
+        storage[storageIndex(innerCount)] = element
+        innerCount += 1
+    }
+
+    /// Removes the element at the back.
+    ///
+    /// - returns: Removed element or `nil` if deque is empty.
+    mutating func popBack() -> T? {
+        if innerCount == 0 {
+            return nil
+        }
+
+        innerCount -= 1
+        let index = storageIndex(innerCount)
+
+        defer { storage[index] = nil }
+        return storage[index]
+    }
+
+    /// Removes the element at the front.
+    ///
+    /// - returns: Removed element or `nil` if deque is empty.
+    mutating func popFront() -> T? {
+        if innerCount == 0 {
+            return nil
+        }
+
+        let element = storage[headIndex]
+        storage[headIndex] = nil
+
+        headIndex += 1
+        if headIndex == storage.count {
+            headIndex = 0
+        }
+        innerCount -= 1
+
+        return element
+    }
+}
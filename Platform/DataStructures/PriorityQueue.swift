@@ -6,18 +6,25 @@
 //  Copyright © 2015 Krunoslav Zaher. All rights reserved.
 //
 
-struct PriorityQueue<Element> {
+/// Element that remembers its position inside of a `PriorityQueue`, which makes `remove` O(log n).
+protocol PriorityQueueElement: AnyObject {
+    /// Index of the element in the queue storage, `nil` when the element isn't enqueued.
+    ///
+    /// Maintained by `PriorityQueue`.
+    var priorityQueueIndex: Int? { get set }
+}
+
+struct PriorityQueue<Element: PriorityQueueElement> {
     private let hasHigherPriority: (Element, Element) -> Bool
-    private let isEqual: (Element, Element) -> Bool
 
     private var elements = [Element]()
 
-    init(hasHigherPriority: @escaping (Element, Element) -> Bool, isEqual: @escaping (Element, Element) -> Bool) {
+    init(hasHigherPriority: @escaping (Element, Element) -> Bool) {
         self.hasHigherPriority = hasHigherPriority
-        self.isEqual = isEqual
     }
 
     mutating func enqueue(_ element: Element) {
+        element.priorityQueueIndex = elements.count
         elements.append(element)
         bubbleToHigherPriority(elements.count - 1)
     }
@@ -30,6 +37,10 @@ struct PriorityQueue<Element> {
         elements.count == 0
     }
 
+    var count: Int {
+        elements.count
+    }
+
     mutating func dequeue() -> Element? {
         guard let front = peek() else {
             return nil
@@ -41,21 +52,20 @@ struct PriorityQueue<Element> {
     }
 
     mutating func remove(_ element: Element) {
-        for i in 0 ..< elements.count {
-            if isEqual(elements[i], element) {
-                removeAt(i)
-                return
-            }
+        guard let index = element.priorityQueueIndex, index < elements.count, elements[index] === element else {
+            return
         }
+
+        removeAt(index)
     }
 
     private mutating func removeAt(_ index: Int) {
         let removingLast = index == elements.count - 1
         if !removingLast {
-            elements.swapAt(index, elements.count - 1)
+            swapAt(index, elements.count - 1)
         }
 
-        _ = elements.popLast()
+        elements.popLast()?.priorityQueueIndex = nil
 
         if !removingLast {
             bubbleToHigherPriority(index)
@@ -72,7 +82,7 @@ struct PriorityQueue<Element> {
         while unbalancedIndex > 0 {
             let parentIndex = (unbalancedIndex - 1) / 2
             guard hasHigherPriority(elements[unbalancedIndex], elements[parentIndex]) else { break }
-            elements.swapAt(unbalancedIndex, parentIndex)
+            swapAt(unbalancedIndex, parentIndex)
             unbalancedIndex = parentIndex
         }
     }
@@ -97,11 +107,17 @@ struct PriorityQueue<Element> {
             }
 
             guard highestPriorityIndex != unbalancedIndex else { break }
-            elements.swapAt(highestPriorityIndex, unbalancedIndex)
+            swapAt(highestPriorityIndex, unbalancedIndex)
 
             unbalancedIndex = highestPriorityIndex
         }
     }
+
+    private mutating func swapAt(_ i: Int, _ j: Int) {
+        elements.swapAt(i, j)
+        elements[i].priorityQueueIndex = i
+        elements[j].priorityQueueIndex = j
+    }
 }
 
 extension PriorityQueue: CustomDebugStringConvertible {
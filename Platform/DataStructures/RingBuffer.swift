@@ -0,0 +1,88 @@
+//
+//  RingBuffer.swift
+//  Platform
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/**
+ Data structure that represents a fixed capacity FIFO queue.
+
+ Unlike `Queue`, storage is allocated once and never resized, so `enqueue` and `dequeue`
+ are always O(1) and never allocate.
+ */
+struct RingBuffer<T> {
+    private var storage: ContiguousArray<T?>
+    private var headIndex = 0
+    private var innerCount = 0
+
+    /**
+     Creates new ring buffer.
+
+     - parameter capacity: Maximum number of elements the buffer can hold.
+     */
+    init(capacity: Int) {
+        precondition(capacity > 0)
+
+        storage = ContiguousArray<T?>(repeating: nil, count: capacity)
+    }
+
+    /// - returns: Maximum number of elements the buffer can hold.
+    var capacity: Int { storage.count }
+
+    /// - returns: Number of elements inside the buffer.
+    var count: Int { innerCount }
+
+    /// - returns: Is buffer empty.
+    var isEmpty: Bool { innerCount == 0 }
+
+    /// - returns: Is buffer full.
+    var isFull: Bool { innerCount == storage.count }
+
+    /// Enqueues `element`.
+    ///
+    /// - parameter element: Element to enqueue.
+    /// - returns: `false` if the buffer is full and `element` wasn't enqueued.
+    @discardableResult
+    mutating func enqueue(_ element: T) -> Bool {
+        if isFull {
+            return false
+        }
+
+        var index = headIndex + innerCount
+        if index >= storage.count {
+            index -= storage.count
+        }
+
+        storage[index] = element
+        innerCount += 1
+
+        return true
+    }
+
+    /// Dequeues the oldest element.
+    ///
+    /// - returns: Dequeued element or `nil` if the buffer is empty.
+    mutating func dequeue() -> T? {
+        if innerCount == 0 {
+            return nil
+        }
+
+        let element = storage[headIndex]
+        storage[headIndex] = nil
+
+        headIndex += 1
+        if headIndex == storage.count {
+            headIndex = 0
+        }
+        innerCount -= 1
+
+        return element
+    }
+
+    /// Removes all elements while keeping the storage.
+    mutating func removeAll() {
+        while dequeue() != nil {}
+    }
+}
@@ -0,0 +1,176 @@
+//
+//  SegmentedBuffer.swift
+//  Platform
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/**
+ Data structure that represents a queue stored in fixed-size, append-only segments.
+
+ Elements are appended at the back and removed from the front. A removed element stays in memory until all elements
+ of its segment are removed, and then the whole segment is released at once.
+
+ `snapshot()` returns an immutable view of the current elements in O(1), without copying them. Later changes of the
+ buffer never affect a snapshot, so a snapshot taken under the synchronization that guards the buffer can be read
+ without any synchronization.
+
+ Complexity of `append` and `removeFirst` is O(1).
+ */
+struct SegmentedBuffer<T> {
+    typealias Segment = SegmentedBufferSegment<T>
+
+    private let segmentCapacity: Int
+
+    private var head: Segment?
+    private var headIndex = 0
+    private var tail: Segment?
+    private var innerCount = 0
+
+    /**
+     Creates new buffer.
+
+     - parameter segmentCapacity: Number of elements per segment.
+     */
+    init(segmentCapacity: Int) {
+        self.segmentCapacity = Swift.max(segmentCapacity, 1)
+    }
+
+    /// - returns: Is buffer empty.
+    var isEmpty: Bool { innerCount == 0 }
+
+    /// - returns: Number of elements inside buffer.
+    var count: Int { innerCount }
+
+    /// - returns: Element in front of the buffer, `nil` if buffer is empty.
+    var first: T? {
+        guard let head, innerCount > 0 else {
+            return nil
+        }
+
+        return head.storage[headIndex]
+    }
+
+    /// Appends `element` to the back.
+    ///
+    /// - parameter element: Element to append.
+    mutating func append(_ element: T) {
+        if tail == nil || tail!.count == tail!.capacity {
+            let segment = Segment(capacity: segmentCapacity)
+            if let tail {
+                tail.next = segment
+            } else {
+                head = segment
+                headIndex = 0
+            }
+            tail = segment
+        }
+
+        tail!.append(element)
+        innerCount += 1
+    }
+
+    /// Removes the element in front of the buffer.
+    mutating func removeFirst() {
+        precondition(innerCount > 0)
+
+        innerCount -= 1
+        headIndex += 1
+
+        if innerCount == 0 {
+            // Nothing is kept alive by an empty buffer.
+            head = nil
+            tail = nil
+            headIndex = 0
+        } else if headIndex == segmentCapacity {
+            head = head!.next
+            headIndex = 0
+        }
+    }
+
+    /// Removes all elements.
+    mutating func removeAll() {
+        head = nil
+        tail = nil
+        headIndex = 0
+        innerCount = 0
+    }
+
+    /// - returns: Immutable view of the current elements.
+    func snapshot() -> Snapshot {
+        Snapshot(head: head, headIndex: headIndex, count: innerCount)
+    }
+
+    /// Immutable view of the elements of a `SegmentedBuffer`.
+    struct Snapshot: Sequence {
+        fileprivate let head: Segment?
+        fileprivate let headIndex: Int
+
+        /// Number of elements in the snapshot.
+        let count: Int
+
+        func makeIterator() -> Iterator {
+            Iterator(segment: head, index: headIndex, remaining: count)
+        }
+    }
+
+    struct Iterator: IteratorProtocol {
+        fileprivate var segment: Segment?
+        fileprivate var index: Int
+        fileprivate var remaining: Int
+
+        mutating func next() -> T? {
+            guard remaining > 0, var segment else {
+                return nil
+            }
+
+            // Segments before the last one in the snapshot were full when the snapshot was taken,
+            // so their `next` can't change anymore.
+            if index == segment.capacity {
+                segment = segment.next!
+                self.segment = segment
+                index = 0
+            }
+
+            defer {
+                index += 1
+                remaining -= 1
+            }
+            return segment.storage[index]
+        }
+    }
+}
+
+final class SegmentedBufferSegment<T> {
+    let capacity: Int
+    fileprivate let storage: UnsafeMutablePointer<T>
+
+    // Only ever grows, elements below it are never written again.
+    fileprivate private(set) var count = 0
+    fileprivate var next: SegmentedBufferSegment<T>?
+
+    fileprivate init(capacity: Int) {
+        self.capacity = capacity
+        storage = UnsafeMutablePointer<T>.allocate(capacity: capacity)
+    }
+
+    fileprivate func append(_ element: T) {
+        (storage + count).initialize(to: element)
+        count += 1
+    }
+
+    deinit {
+        // Release the rest of the chain iteratively, a long chain would overflow the stack otherwise.
+        var node = next
+        next = nil
+        while isKnownUniquelyReferenced(&node) {
+            let following = node?.next
+            node?.next = nil
+            node = following
+        }
+
+        storage.deinitialize(count: count)
+        storage.deallocate()
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  NonRecursiveLock.swift
+//  Platform
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#endif
+
+/**
+ Plain (non recursive) mutex for leaf critical sections.
+
+ Unlike `RecursiveLock` this isn't a Foundation object and doesn't pay for recursion bookkeeping,
+ so it should be used for critical sections that never call out to code that could reenter them.
+
+ Locking it twice on the same thread is undefined behavior (it will usually deadlock).
+ */
+final class NonRecursiveLock: @unchecked Sendable {
+    private let mutex: UnsafeMutablePointer<pthread_mutex_t>
+
+    init() {
+        #if TRACE_RESOURCES
+        _ = Resources.incrementTotal()
+        #endif
+        mutex = UnsafeMutablePointer<pthread_mutex_t>.allocate(capacity: 1)
+        mutex.initialize(to: pthread_mutex_t())
+        let result = pthread_mutex_init(mutex, nil)
+        precondition(result == 0, "Failed to initialize mutex")
+    }
+
+    @inline(__always)
+    func lock() {
+        pthread_mutex_lock(mutex)
+    }
+
+    @inline(__always)
+    func unlock() {
+        pthread_mutex_unlock(mutex)
+    }
+
+    deinit {
+        pthread_mutex_destroy(mutex)
+        mutex.deinitialize(count: 1)
+        mutex.deallocate()
+        #if TRACE_RESOURCES
+        _ = Resources.decrementTotal()
+        #endif
+    }
+}
@@ -0,0 +1,176 @@
+//
+//  BlockingObservable+Iterator.swift
+//  RxBlocking
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+import RxSwift
+
+public extension BlockingObservable {
+    /// Subscribes to the sequence and returns an iterator that pulls its elements one at a time.
+    ///
+    /// The sequence is subscribed to on a background queue. At most `bufferSize` elements that weren't pulled yet are
+    /// buffered, after that the thread that produces elements is blocked until the consumer catches up, so
+    /// arbitrarily long sequences are processed in constant memory.
+    ///
+    /// The iterator parks the current thread on a condition variable regardless of `waitStrategy`, so the sequence
+    /// must not depend on the current thread's run loop. `timeout` applies to every call of `next()`.
+    ///
+    /// ```swift
+    /// let iterator = observable.toBlocking().iterator(bufferSize: 64)
+    /// while let element = try iterator.next() {
+    ///     // Handle element
+    /// }
+    /// ```
+    ///
+    /// - parameter bufferSize: Maximum number of elements buffered ahead of the consumer.
+    /// - returns: Iterator over the elements of the sequence.
+    func iterator(bufferSize: Int = 128) -> BlockingIterator<Element> {
+        guard bufferSize > 0 else {
+            fatalError("bufferSize must be positive")
+        }
+
+        let buffer = BlockingIteratorBuffer<Element>(capacity: bufferSize, timeout: timeout)
+        buffer.subscribe(to: source.subscribe(on: ConcurrentDispatchQueueScheduler(qos: .default)))
+        return BlockingIterator(buffer: buffer)
+    }
+}
+
+/// Iterator over the elements of a `BlockingObservable`.
+///
+/// The subscription is disposed when the sequence terminates, when `dispose()` is called or when the iterator
+/// is deallocated.
+public final class BlockingIterator<Element>: Disposable {
+    private let buffer: BlockingIteratorBuffer<Element>
+
+    fileprivate init(buffer: BlockingIteratorBuffer<Element>) {
+        self.buffer = buffer
+    }
+
+    /// Blocks current thread until the next element is available.
+    ///
+    /// - returns: Next element, or `nil` when the sequence completed or the iterator was disposed.
+    /// - throws: Error of the sequence, or `RxError.timeout` if no element arrived in time.
+    public func next() throws -> Element? {
+        try buffer.next()
+    }
+
+    /// Stops the iteration and disposes the subscription.
+    public func dispose() {
+        buffer.dispose()
+    }
+
+    deinit {
+        buffer.dispose()
+    }
+}
+
+/// Bounded single-consumer buffer between a subscription and a blocking iterator.
+private final class BlockingIteratorBuffer<Element>: ObserverType {
+    private let condition = NSCondition()
+    private let capacity: Int
+    private let timeout: TimeInterval?
+    private let subscription = SingleAssignmentDisposable()
+
+    // state
+    private var elements: ContiguousArray<Element?>
+    private var head = 0
+    private var count = 0
+    private var termination: Swift.Error??
+    private var isDisposed = false
+
+    init(capacity: Int, timeout: TimeInterval?) {
+        self.capacity = capacity
+        self.timeout = timeout
+        elements = ContiguousArray(repeating: nil, count: capacity)
+    }
+
+    func subscribe(to source: Observable<Element>) {
+        subscription.setDisposable(source.subscribe(self))
+    }
+
+    func on(_ event: Event<Element>) {
+        condition.lock()
+        defer { condition.unlock() }
+
+        switch event {
+        case let .next(element):
+            while count == capacity, !isDisposed {
+                condition.wait()
+            }
+
+            if isDisposed || termination != nil {
+                return
+            }
+
+            elements[(head + count) % capacity] = element
+            count += 1
+        case let .error(error):
+            if termination == nil {
+                termination = .some(error)
+            }
+        case .completed:
+            if termination == nil {
+                termination = .some(nil)
+            }
+        }
+
+        condition.broadcast()
+    }
+
+    func next() throws -> Element? {
+        let deadline = timeout.map { Date().addingTimeInterval($0) }
+
+        condition.lock()
+
+        while count == 0, termination == nil, !isDisposed {
+            if let deadline {
+                if !condition.wait(until: deadline), count == 0, termination == nil, !isDisposed {
+                    condition.unlock()
+                    dispose()
+                    throw RxError.timeout
+                }
+            } else {
+                condition.wait()
+            }
+        }
+
+        if count > 0 {
+            let element = elements[head]
+            elements[head] = nil
+            head = (head + 1) % capacity
+            count -= 1
+            condition.broadcast()
+            condition.unlock()
+            return element
+        }
+
+        // The error is reported only once, `nil` after that.
+        let error = termination ?? nil
+        termination = .some(nil)
+        condition.unlock()
+
+        subscription.dispose()
+
+        if let error {
+            throw error
+        }
+
+        return nil
+    }
+
+    func dispose() {
+        condition.lock()
+        isDisposed = true
+        elements = ContiguousArray(repeating: nil, count: capacity)
+        count = 0
+        condition.broadcast()
+        condition.unlock()
+
+        subscription.dispose()
+    }
+}
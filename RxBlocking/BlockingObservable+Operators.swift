@@ -105,7 +105,7 @@ extension BlockingObservable {
         var elements = [Element]()
         var error: Swift.Error?
 
-        let lock = RunLoopLock(timeout: timeout)
+        let lock = waitStrategy.makeLock(timeout: timeout)
 
         let d = SingleAssignmentDisposable()
 
@@ -19,5 +19,6 @@ import RxSwift
  */
 public struct BlockingObservable<Element> {
     let timeout: TimeInterval?
+    let waitStrategy: BlockingWaitStrategy
     let source: Observable<Element>
 }
@@ -0,0 +1,76 @@
+//
+//  ConditionLock.swift
+//  RxBlocking
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+import RxSwift
+
+/// `BlockingLock` that parks the current thread on a condition variable instead of running its run loop.
+final class ConditionLock: BlockingLock {
+    private let condition = NSCondition()
+
+    let calledRun = AtomicInt(0)
+    let timeout: TimeInterval?
+
+    // state
+    private var actions = [() -> Void]()
+    private var isStopped = false
+
+    init(timeout: TimeInterval?) {
+        self.timeout = timeout
+    }
+
+    func dispatch(_ action: @escaping () -> Void) {
+        condition.lock()
+        actions.append(action)
+        condition.signal()
+        condition.unlock()
+    }
+
+    func stop() {
+        condition.lock()
+        isStopped = true
+        condition.signal()
+        condition.unlock()
+    }
+
+    func run() throws {
+        if increment(calledRun) != 0 {
+            fatalError("Run can be only called once")
+        }
+
+        let deadline = timeout.map { Date().addingTimeInterval($0) }
+
+        while true {
+            condition.lock()
+            while actions.isEmpty, !isStopped {
+                if let deadline {
+                    if !condition.wait(until: deadline), actions.isEmpty, !isStopped {
+                        condition.unlock()
+                        throw RxError.timeout
+                    }
+                } else {
+                    condition.wait()
+                }
+            }
+
+            let pending = actions
+            actions.removeAll()
+            let isStopped = self.isStopped
+            condition.unlock()
+
+            // Like a run loop, actions dispatched before `stop` are still performed.
+            for action in pending {
+                performTrampolined(action)
+            }
+
+            if isStopped {
+                return
+            }
+        }
+    }
+}
@@ -9,12 +9,28 @@
 import Foundation
 import RxSwift
 
+/// The way a `BlockingObservable` blocks the current thread.
+public enum BlockingWaitStrategy {
+    /// Runs the current thread's run loop until the sequence terminates.
+    ///
+    /// Work scheduled on the current thread's run loop, e.g. on `MainScheduler` while blocking the main thread,
+    /// keeps running while blocked.
+    case runLoop
+
+    /// Parks the current thread on a condition variable until the sequence terminates.
+    ///
+    /// Wakes up with lower latency and without CoreFoundation overhead, but work scheduled on the current thread's
+    /// run loop doesn't run while blocked, so it must not be used to wait for such work.
+    case condition
+}
+
 public extension ObservableConvertibleType {
     /// Converts an Observable into a `BlockingObservable` (an Observable with blocking operators).
     ///
     /// - parameter timeout: Maximal time interval BlockingObservable can block without throwing `RxError.timeout`.
+    /// - parameter waitStrategy: The way blocking operators block the current thread.
     /// - returns: `BlockingObservable` version of `self`
-    func toBlocking(timeout: TimeInterval? = nil) -> BlockingObservable<Element> {
-        BlockingObservable(timeout: timeout, source: asObservable())
+    func toBlocking(timeout: TimeInterval? = nil, waitStrategy: BlockingWaitStrategy = .runLoop) -> BlockingObservable<Element> {
+        BlockingObservable(timeout: timeout, waitStrategy: waitStrategy, source: asObservable())
     }
 }
@@ -1 +0,0 @@
-../../Platform/Platform.Darwin.swift
\ No newline at end of file
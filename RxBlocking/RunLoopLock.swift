@@ -20,7 +20,39 @@ let runLoopMode: CFRunLoopMode = .defaultMode
 let runLoopModeRaw = runLoopMode.rawValue
 #endif
 
-final class RunLoopLock {
+/// Blocks the current thread in `run` until `stop` is called.
+///
+/// Actions passed to `dispatch` are performed on the blocked thread.
+protocol BlockingLock {
+    func dispatch(_ action: @escaping () -> Void)
+    func stop()
+    func run() throws
+}
+
+extension BlockingWaitStrategy {
+    func makeLock(timeout: TimeInterval?) -> BlockingLock {
+        switch self {
+        case .runLoop:
+            return RunLoopLock(timeout: timeout)
+        case .condition:
+            return ConditionLock(timeout: timeout)
+        }
+    }
+}
+
+/// Performs `action` on the current thread's trampoline.
+func performTrampolined(_ action: @escaping () -> Void) {
+    if CurrentThreadScheduler.isScheduleRequired {
+        _ = CurrentThreadScheduler.instance.schedule(()) { _ in
+            action()
+            return Disposables.create()
+        }
+    } else {
+        action()
+    }
+}
+
+final class RunLoopLock: BlockingLock {
     let currentRunLoop: CFRunLoop
 
     let calledRun = AtomicInt(0)
@@ -34,14 +66,7 @@ final class RunLoopLock {
 
     func dispatch(_ action: @escaping () -> Void) {
         CFRunLoopPerformBlock(currentRunLoop, runLoopModeRaw) {
-            if CurrentThreadScheduler.isScheduleRequired {
-                _ = CurrentThreadScheduler.instance.schedule(()) { _ in
-                    action()
-                    return Disposables.create()
-                }
-            } else {
-                action()
-            }
+            performTrampolined(action)
         }
         CFRunLoopWakeUp(currentRunLoop)
     }
@@ -31,6 +31,17 @@ public final class ReplayRelay<Element>: ObservableType {
         ReplayRelay(subject: ReplaySubject.create(bufferSize: bufferSize))
     }
 
+    /// Creates new instance of `ReplayRelay` that replays at most `bufferSize` last elements sent to it
+    /// during the last `window` time.
+    ///
+    /// - parameter bufferSize: Maximal number of elements to replay to observers after subscription.
+    /// - parameter window: Maximal age of elements to replay to observers after subscription.
+    /// - parameter scheduler: Scheduler used to timestamp elements.
+    /// - returns: New instance of replay relay.
+    public static func create(bufferSize: Int, window: RxTimeInterval, scheduler: SchedulerType) -> ReplayRelay<Element> {
+        ReplayRelay(subject: ReplaySubject.create(bufferSize: bufferSize, window: window, scheduler: scheduler))
+    }
+
     /// Creates a new instance of `ReplayRelay` that buffers all the sent to it.
     /// To avoid filling up memory, developer needs to make sure that the use case will only ever store a 'reasonable'
     /// number of elements.
@@ -0,0 +1,222 @@
+//
+//  AsyncValues.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#if swift(>=5.7)
+
+/// Policy for elements that arrive while an async consumer isn't waiting for them.
+public enum AsyncValuesBufferingPolicy {
+    /// Buffers all elements.
+    case unbounded
+
+    /// Buffers at most the given number of elements, and drops elements that arrive while the buffer is full.
+    case bufferingOldest(Int)
+
+    /// Buffers at most the given number of elements, and drops the oldest buffered element when a new one arrives
+    /// while the buffer is full.
+    case bufferingNewest(Int)
+}
+
+/**
+ Asynchronous sequence of the elements of an observable sequence.
+
+ Every iteration subscribes to the source sequence once, and disposes the subscription when the iteration ends
+ or its task is cancelled. Elements that arrive while the consumer isn't waiting are buffered according to
+ the buffering policy.
+ */
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+public struct ObservableValues<Element>: AsyncSequence {
+    public typealias AsyncIterator = Iterator
+
+    private let source: Observable<Element>
+    private let bufferingPolicy: AsyncValuesBufferingPolicy
+
+    init(source: Observable<Element>, bufferingPolicy: AsyncValuesBufferingPolicy) {
+        self.source = source
+        self.bufferingPolicy = bufferingPolicy
+    }
+
+    public func makeAsyncIterator() -> Iterator {
+        Iterator(consumer: AsyncValuesConsumer(source: source, bufferingPolicy: bufferingPolicy))
+    }
+
+    public struct Iterator: AsyncIteratorProtocol {
+        private let consumer: AsyncValuesConsumer<Element>
+
+        init(consumer: AsyncValuesConsumer<Element>) {
+            self.consumer = consumer
+        }
+
+        /// - returns: Next element, or `nil` when the sequence completed or the task was cancelled.
+        /// - throws: Error of the source sequence, or `CancellationError` if the subscription was disposed before it terminated.
+        public mutating func next() async throws -> Element? {
+            try await consumer.next()
+        }
+    }
+}
+
+/// Owned by the iterator only, so the subscription is disposed as soon as the iterator goes away.
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+final class AsyncValuesConsumer<Element> {
+    private let buffer: AsyncValuesBuffer<Element>
+
+    init(source: Observable<Element>, bufferingPolicy: AsyncValuesBufferingPolicy) {
+        buffer = AsyncValuesBuffer(bufferingPolicy: bufferingPolicy)
+        buffer.subscribe(to: source)
+    }
+
+    func next() async throws -> Element? {
+        try await withTaskCancellationHandler(
+            operation: {
+                try await withCheckedThrowingContinuation { continuation in
+                    self.buffer.next(continuation)
+                }
+            },
+            onCancel: { [buffer] in
+                buffer.cancel()
+            }
+        )
+    }
+
+    deinit {
+        buffer.cancel()
+    }
+}
+
+/// Single-consumer buffer between a subscription and an async iterator.
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private final class AsyncValuesBuffer<Element>: ObserverType {
+    typealias Consumer = CheckedContinuation<Element?, Error>
+
+    private let lock = SpinLock()
+    private let bufferingPolicy: AsyncValuesBufferingPolicy
+    private let subscription = SingleAssignmentDisposable()
+
+    // state
+    private var elements = Queue<Element>(capacity: 0)
+    private var consumer: Consumer?
+    private var termination: Result<Void, Error>?
+
+    init(bufferingPolicy: AsyncValuesBufferingPolicy) {
+        self.bufferingPolicy = bufferingPolicy
+    }
+
+    func subscribe(to source: Observable<Element>) {
+        subscription.setDisposable(source.subscribe(
+            onNext: { element in self.on(.next(element)) },
+            onError: { error in self.on(.error(error)) },
+            onCompleted: { self.on(.completed) },
+            // Disposed before the source terminated.
+            onDisposed: { self.terminate(.failure(CancellationError())) }
+        ))
+    }
+
+    func on(_ event: Event<Element>) {
+        switch event {
+        case let .next(element):
+            let consumer = lock.performLocked { () -> Consumer? in
+                if termination != nil {
+                    return nil
+                }
+
+                if let consumer = self.consumer {
+                    self.consumer = nil
+                    return consumer
+                }
+
+                synchronized_buffer(element)
+                return nil
+            }
+
+            consumer?.resume(returning: element)
+        case let .error(error):
+            terminate(.failure(error))
+        case .completed:
+            terminate(.success(()))
+        }
+    }
+
+    private func synchronized_buffer(_ element: Element) {
+        switch bufferingPolicy {
+        case .unbounded:
+            elements.enqueue(element)
+        case let .bufferingOldest(limit):
+            if elements.count < limit {
+                elements.enqueue(element)
+            }
+        case let .bufferingNewest(limit):
+            guard limit > 0 else {
+                return
+            }
+            if elements.count == limit {
+                _ = elements.dequeue()
+            }
+            elements.enqueue(element)
+        }
+    }
+
+    func next(_ continuation: Consumer) {
+        let result = lock.performLocked { () -> Result<Element?, Error>? in
+            if let element = elements.dequeue() {
+                return .success(element)
+            }
+
+            if termination != nil {
+                return synchronized_takeTermination()
+            }
+
+            consumer = continuation
+            return nil
+        }
+
+        if let result {
+            continuation.resume(with: result)
+        }
+    }
+
+    /// Stops the iteration, the consumer finishes without an error.
+    func cancel() {
+        terminate(.success(()), discardingElements: true)
+        subscription.dispose()
+    }
+
+    private func terminate(_ termination: Result<Void, Error>, discardingElements: Bool = false) {
+        let (consumer, result) = lock.performLocked { () -> (Consumer?, Result<Element?, Error>?) in
+            if discardingElements {
+                elements = Queue(capacity: 0)
+            }
+
+            if self.termination == nil {
+                self.termination = termination
+            }
+
+            guard let consumer = self.consumer else {
+                return (nil, nil)
+            }
+
+            self.consumer = nil
+            return (consumer, synchronized_takeTermination())
+        }
+
+        if let consumer, let result {
+            consumer.resume(with: result)
+        }
+    }
+
+    /// Error is reported only once, the consumer gets `nil` after that.
+    private func synchronized_takeTermination() -> Result<Element?, Error> {
+        defer { termination = .success(()) }
+
+        switch termination {
+        case let .failure(error)?:
+            return .failure(error)
+        case .success?, nil:
+            return .success(nil)
+        }
+    }
+}
+#endif
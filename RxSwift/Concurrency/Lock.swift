@@ -12,7 +12,11 @@ protocol Lock {
 }
 
 // https://lists.swift.org/pipermail/swift-dev/Week-of-Mon-20151214/000321.html
-typealias SpinLock = RecursiveLock
+//
+// `SpinLock` is used for leaf critical sections that never call out to code that could
+// reenter them (disposables, queues, scheduler bookkeeping).
+// Everything that forwards events or subscribes while holding a lock must use `RecursiveLock`.
+typealias SpinLock = NonRecursiveLock
 
 extension RecursiveLock: Lock {
     @inline(__always)
@@ -21,3 +25,11 @@ extension RecursiveLock: Lock {
         return action()
     }
 }
+
+extension NonRecursiveLock: Lock {
+    @inline(__always)
+    func performLocked<T>(_ action: () -> T) -> T {
+        lock(); defer { self.unlock() }
+        return action()
+    }
+}
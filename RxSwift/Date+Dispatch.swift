@@ -32,6 +32,28 @@ extension DispatchTimeInterval {
         }
     }
 
+    /// Length of the interval in nanoseconds, or `nil` for `.never`.
+    ///
+    /// Intervals that don't fit into `Int64` nanoseconds, e.g. `.seconds(Int.max)`, saturate instead of trapping.
+    var nanoseconds: Int64? {
+        switch self {
+        case let .nanoseconds(value): return Int64(value)
+        case let .microseconds(value): return DispatchTimeInterval.saturatingNanoseconds(value, 1000)
+        case let .milliseconds(value): return DispatchTimeInterval.saturatingNanoseconds(value, 1_000_000)
+        case let .seconds(value): return DispatchTimeInterval.saturatingNanoseconds(value, 1_000_000_000)
+        case .never: return nil
+        @unknown default: fatalError()
+        }
+    }
+
+    private static func saturatingNanoseconds(_ value: Int, _ factor: Int64) -> Int64 {
+        let (nanoseconds, overflow) = Int64(value).multipliedReportingOverflow(by: factor)
+        guard !overflow else {
+            return value < 0 ? Int64.min : Int64.max
+        }
+        return nanoseconds
+    }
+
     var isNow: Bool {
         switch self {
         case let .nanoseconds(value), let .microseconds(value), let .milliseconds(value), let .seconds(value): return value == 0
@@ -114,12 +114,18 @@ public extension DisposeBag {
 
     /// Convenience function allows an array of disposables to be gathered for disposal.
     func insert(_ disposables: [Disposable]) {
+        _insert(disposables).forEach { $0.dispose() }
+    }
+
+    private func _insert(_ disposables: [Disposable]) -> [Disposable] {
         lock.performLocked {
             if self.isDisposed {
-                disposables.forEach { $0.dispose() }
-            } else {
-                self.disposables += disposables
+                return disposables
             }
+
+            self.disposables += disposables
+
+            return []
         }
     }
 
@@ -24,3 +24,10 @@ public extension Disposables {
      */
     static func create() -> Disposable { NopDisposable.noOp }
 }
+
+extension Disposables {
+    /// - returns: `true` if `disposable` is the shared disposable returned by `create()`.
+    static func isNoOp(_ disposable: Disposable) -> Bool {
+        disposable is NopDisposable
+    }
+}
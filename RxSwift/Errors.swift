@@ -28,6 +28,8 @@ public enum RxError:
     case moreThanOneElement
     /// Timeout error.
     case timeout
+    /// Buffer capacity was exceeded.
+    case bufferOverflow
 }
 
 public extension RxError {
@@ -48,6 +50,8 @@ public extension RxError {
             "Sequence contains more than one element."
         case .timeout:
             "Sequence timeout."
+        case .bufferOverflow:
+            "Buffer capacity was exceeded."
         }
     }
 }
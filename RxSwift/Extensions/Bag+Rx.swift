@@ -16,14 +16,17 @@ func dispatch<Element>(_ bag: Bag<(Event<Element>) -> Void>, _ event: Event<Elem
         return
     }
 
-    let pairs = bag._pairs
-    for i in 0 ..< pairs.count {
-        pairs[i].value(event)
+    let values = bag._values
+    for i in 0 ..< values.count {
+        values[i]?(event)
     }
+}
 
-    if let dictionary = bag._dictionary {
-        for element in dictionary.values {
-            element(event)
+@inline(__always)
+func dispatch<Element>(_ observers: ContiguousArray<(Event<Element>) -> Void>, _ event: Event<Element>) {
+    observers.withUnsafeBufferPointer { observers in
+        for observer in observers {
+            observer(event)
         }
     }
 }
@@ -36,14 +39,66 @@ func disposeAll(in bag: Bag<Disposable>) {
         return
     }
 
-    let pairs = bag._pairs
-    for i in 0 ..< pairs.count {
-        pairs[i].value.dispose()
+    let values = bag._values
+    for i in 0 ..< values.count {
+        values[i]?.dispose()
     }
+}
+
+// MARK: snapshots
+
+/**
+ `Bag` that additionally keeps an immutable contiguous snapshot of its elements.
 
-    if let dictionary = bag._dictionary {
-        for element in dictionary.values {
-            element.dispose()
+ The snapshot is invalidated when elements are inserted or removed and lazily rebuilt on the next
+ `snapshot()` call, so repeatedly reading it without changes in between only retains the shared storage.
+
+ Subjects use it to dispatch events: taking the snapshot under the lock doesn't copy anything and
+ dispatching is a linear walk over contiguous storage.
+ */
+struct SnapshotBag<T> {
+    typealias KeyType = BagKey
+    typealias Snapshot = ContiguousArray<T>
+
+    private var bag = Bag<T>()
+    private var cachedSnapshot: Snapshot? = Snapshot()
+
+    init() {}
+
+    /// - returns: Number of elements in bag.
+    var count: Int {
+        bag.count
+    }
+
+    mutating func insert(_ element: T) -> BagKey {
+        cachedSnapshot = nil
+        return bag.insert(element)
+    }
+
+    mutating func removeKey(_ key: BagKey) -> T? {
+        guard let element = bag.removeKey(key) else {
+            return nil
         }
+        cachedSnapshot = nil
+        return element
+    }
+
+    /// Removes all elements from bag and clears capacity.
+    mutating func removeAll() {
+        bag.removeAll()
+        cachedSnapshot = Snapshot()
+    }
+
+    /// - returns: Immutable snapshot of all elements in insertion order.
+    mutating func snapshot() -> Snapshot {
+        if let cachedSnapshot {
+            return cachedSnapshot
+        }
+
+        var snapshot = Snapshot()
+        snapshot.reserveCapacity(bag.count)
+        bag.forEach { snapshot.append($0) }
+        cachedSnapshot = snapshot
+        return snapshot
     }
 }
@@ -34,3 +34,26 @@ public extension ImmediateSchedulerType {
         return Disposables.create(with: recursiveScheduler.dispose)
     }
 }
+
+extension ImmediateSchedulerType {
+    /**
+     Schedules an action to be executed recursively, like `scheduleRecursive`.
+
+     On `CurrentThreadScheduler`, recursive invocations requested while nothing else is queued on the trampoline run
+     in a loop instead of going through the trampoline queue. They would run right away anyway, so events are delivered
+     in the same order, but no scheduled item is allocated per invocation.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter action: Action to execute recursively. The last parameter passed to the action is used to trigger recursive scheduling of the action, passing in recursive invocation state.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    func scheduleRecursiveLoop<State>(_ state: State, action: @escaping (_ state: State, _ recurse: (State) -> Void) -> Void) -> Disposable {
+        guard self is CurrentThreadScheduler else {
+            return scheduleRecursive(state, action: action)
+        }
+
+        let loop = TrampolineLoop(action: action)
+        loop.schedule(state)
+        return loop
+    }
+}
@@ -0,0 +1,235 @@
+//
+//  Metrics.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#endif
+
+/**
+ Opt-in runtime metrics of operators.
+
+ Operators that are subscribed while a name is being applied (see `ObservableType.instrument(_:)` and
+ `Metrics.tagging(_:_:)`) report into an entry identified by that name and the operator. Entries aggregate
+ all subscriptions with the same name and operator.
+
+ While `isEnabled` is `false` operators don't register anything, and the only cost is one branch per subscription
+ and one `nil` check per recorded value.
+ */
+public enum Metrics {
+    /// Enables metrics for subscriptions made from now on. Existing subscriptions keep reporting, or not reporting.
+    public static var isEnabled: Bool {
+        get {
+            isFlagSet(enabled, 1)
+        }
+        set {
+            lock.performLocked {
+                _ = newValue ? fetchOr(enabled, 1) : sub(enabled, load(enabled))
+            }
+        }
+    }
+
+    /**
+     Runs `body` with `name` applied to operators subscribed or created in it on the current thread.
+
+     The innermost name wins when calls are nested.
+
+     - parameter name: Name that tags the metrics entries.
+     - parameter body: Code that subscribes or creates the operators to tag.
+     - returns: Result of `body`.
+     */
+    public static func tagging<Result>(_ name: String, _ body: () throws -> Result) rethrows -> Result {
+        let scope = MetricsScope(name: name)
+        let previous = pthread_getspecific(scopeKey)
+        pthread_setspecific(scopeKey, Unmanaged.passUnretained(scope).toOpaque())
+        defer {
+            pthread_setspecific(scopeKey, previous)
+            withExtendedLifetime(scope) {}
+        }
+
+        return try body()
+    }
+
+    /**
+     Current values of all entries, ordered by name and operator.
+
+     Totals only ever increase, so rates are the differences between two snapshots divided by the time between them.
+     */
+    public static func snapshot() -> [OperatorMetricsSnapshot] {
+        let entries = lock.performLocked { Array(self.entries.values) }
+        return entries
+            .map(\.snapshot)
+            .sorted { ($0.name, $0.operatorName) < ($1.name, $1.operatorName) }
+    }
+
+    /// Handle that `operatorName` reports into, or `nil` if metrics are disabled or no name is applied.
+    static func register(_ operatorName: String) -> OperatorMetrics? {
+        guard isEnabled, let scope = currentScope else {
+            return nil
+        }
+
+        let key = MetricsKey(name: scope.name, operatorName: operatorName)
+        let entry = lock.performLocked { () -> MetricsEntry in
+            if let entry = self.entries[key] {
+                return entry
+            }
+            let entry = MetricsEntry(key: key)
+            self.entries[key] = entry
+            return entry
+        }
+
+        return OperatorMetrics(entry: entry)
+    }
+
+    private static let lock = SpinLock()
+    // Read on every subscription, so it's an atomic load instead of taking `lock`.
+    private static let enabled = AtomicInt(0)
+    private static var entries = [MetricsKey: MetricsEntry]()
+
+    private static let scopeKey: pthread_key_t = { () -> pthread_key_t in
+        let key = UnsafeMutablePointer<pthread_key_t>.allocate(capacity: 1)
+        defer { key.deallocate() }
+
+        guard pthread_key_create(key, nil) == 0 else {
+            rxFatalError("Metrics scope key creation failed")
+        }
+
+        return key.pointee
+    }()
+
+    private static var currentScope: MetricsScope? {
+        guard let scope = pthread_getspecific(scopeKey) else {
+            return nil
+        }
+
+        return Unmanaged<MetricsScope>.fromOpaque(scope).takeUnretainedValue()
+    }
+}
+
+/// Values of a metrics entry at the time of `Metrics.snapshot()`.
+public struct OperatorMetricsSnapshot: Equatable {
+    /// Name applied with `instrument(_:)` or `Metrics.tagging(_:_:)`.
+    public let name: String
+    /// Operator that reported the values, e.g. `observeOn`.
+    public let operatorName: String
+    /// Number of elements the operator received.
+    public let eventsIn: Int64
+    /// Number of elements the operator delivered.
+    public let eventsOut: Int64
+    /// Number of elements currently buffered by all live subscriptions.
+    public let bufferDepth: Int
+    /// Highest `bufferDepth` so far.
+    public let peakBufferDepth: Int
+    /// Number of live subscriptions.
+    public let liveSubscriptions: Int
+    /// Number of subscriptions made so far.
+    public let subscriptions: Int64
+    /// Number of subscriptions released so far.
+    public let disposals: Int64
+}
+
+private final class MetricsScope {
+    let name: String
+
+    init(name: String) {
+        self.name = name
+    }
+}
+
+private struct MetricsKey: Hashable {
+    let name: String
+    let operatorName: String
+}
+
+private final class MetricsEntry {
+    let key: MetricsKey
+    let lock = SpinLock()
+
+    // state
+    var eventsIn: Int64 = 0
+    var eventsOut: Int64 = 0
+    var bufferDepth = 0
+    var peakBufferDepth = 0
+    var liveSubscriptions = 0
+    var subscriptions: Int64 = 0
+    var disposals: Int64 = 0
+
+    init(key: MetricsKey) {
+        self.key = key
+    }
+
+    var snapshot: OperatorMetricsSnapshot {
+        lock.performLocked {
+            OperatorMetricsSnapshot(
+                name: self.key.name,
+                operatorName: self.key.operatorName,
+                eventsIn: self.eventsIn,
+                eventsOut: self.eventsOut,
+                bufferDepth: self.bufferDepth,
+                peakBufferDepth: self.peakBufferDepth,
+                liveSubscriptions: self.liveSubscriptions,
+                subscriptions: self.subscriptions,
+                disposals: self.disposals
+            )
+        }
+    }
+}
+
+/// Reports values of a single subscription, or a single subject, into its metrics entry.
+///
+/// The subscription is counted as live until the handle is released.
+final class OperatorMetrics {
+    private let entry: MetricsEntry
+
+    // state, guarded by the entry lock
+    private var bufferDepth = 0
+
+    fileprivate init(entry: MetricsEntry) {
+        self.entry = entry
+        entry.lock.performLocked {
+            entry.subscriptions += 1
+            entry.liveSubscriptions += 1
+        }
+    }
+
+    func received(_ count: Int = 1) {
+        entry.lock.performLocked {
+            self.entry.eventsIn += Int64(count)
+        }
+    }
+
+    func sent(_ count: Int = 1) {
+        entry.lock.performLocked {
+            self.entry.eventsOut += Int64(count)
+        }
+    }
+
+    /// Reports the number of elements this subscription currently buffers.
+    func buffered(_ depth: Int) {
+        entry.lock.performLocked {
+            self.entry.bufferDepth += depth - self.bufferDepth
+            self.entry.peakBufferDepth = Swift.max(self.entry.peakBufferDepth, self.entry.bufferDepth)
+            self.bufferDepth = depth
+        }
+    }
+
+    deinit {
+        let entry = entry
+        let bufferDepth = bufferDepth
+        entry.lock.performLocked {
+            entry.bufferDepth -= bufferDepth
+            entry.liveSubscriptions -= 1
+            entry.disposals += 1
+        }
+    }
+}
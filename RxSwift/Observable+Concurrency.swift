@@ -50,6 +50,25 @@ public extension ObservableConvertibleType {
             }
         }
     }
+
+    /// Allows iterating over the values of an Observable
+    /// asynchronously via Swift's concurrency features (`async/await`),
+    /// buffering elements that arrive while the consumer is busy according to `bufferingPolicy`.
+    ///
+    /// Unlike `values`, the source is subscribed to when iteration starts, and a bounded policy keeps memory
+    /// bounded when the consumer is slower than the source.
+    ///
+    /// ```swift
+    /// for try await value in observable.values(bufferingPolicy: .bufferingNewest(16)) {
+    ///     // Handle emitted values
+    /// }
+    /// ```
+    ///
+    /// - parameter bufferingPolicy: Policy for elements that arrive while the consumer isn't waiting for them.
+    /// - returns: Asynchronous sequence of the elements.
+    func values(bufferingPolicy: AsyncValuesBufferingPolicy) -> ObservableValues<Element> {
+        ObservableValues(source: asObservable(), bufferingPolicy: bufferingPolicy)
+    }
 }
 
 @available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
@@ -81,5 +100,166 @@ public extension AsyncSequence {
             return Disposables.create { task.cancel() }
         }
     }
+
+    /// Convert an `AsyncSequence` to an `Observable` that delivers elements on `scheduler`.
+    ///
+    /// Iteration runs in a detached task and hands elements off to `scheduler` in order. At most `bufferSize` elements
+    /// are handed off without being delivered yet, iteration is suspended until `scheduler` catches up.
+    ///
+    /// - parameter priority: Priority for the detached task
+    /// - parameter scheduler: Scheduler to deliver events on.
+    /// - parameter bufferSize: Maximum number of elements handed off to `scheduler` and not delivered yet.
+    ///
+    /// - returns: An `Observable` of the async sequence's element type
+    func asObservable(priority: TaskPriority? = nil, scheduler: ImmediateSchedulerType, bufferSize: Int) -> Observable<Element> {
+        guard bufferSize > 0 else {
+            rxFatalError("bufferSize must be positive")
+        }
+
+        return Observable.create { observer in
+            let handoff = AsyncHandoff(observer: observer, scheduler: scheduler, capacity: bufferSize)
+
+            let task = Task.detached(priority: priority) {
+                do {
+                    for try await value in self {
+                        try await handoff.send(value)
+                    }
+
+                    handoff.finish(.completed)
+                } catch is CancellationError {
+                    handoff.finish(.completed)
+                } catch {
+                    handoff.finish(.error(error))
+                }
+            }
+
+            return Disposables.create {
+                task.cancel()
+                handoff.dispose()
+            }
+        }
+    }
+}
+
+/// Bounded handoff of elements from an iterating task to observers on a scheduler.
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private final class AsyncHandoff<Element> {
+    typealias Producer = CheckedContinuation<Void, Error>
+
+    private let lock = SpinLock()
+    private let observer: AnyObserver<Element>
+    private let scheduler: ImmediateSchedulerType
+    private let capacity: Int
+
+    // state
+    private var queue = Queue<Event<Element>>(capacity: 0)
+    private var producer: Producer?
+    private var isDraining = false
+    private var isDisposed = false
+
+    init(observer: AnyObserver<Element>, scheduler: ImmediateSchedulerType, capacity: Int) {
+        self.observer = observer
+        self.scheduler = scheduler
+        self.capacity = capacity
+    }
+
+    /// Hands `element` off, and suspends while the handoff is full.
+    func send(_ element: Element) async throws {
+        if enqueue(.next(element)) >= capacity {
+            try await withTaskCancellationHandler(
+                operation: {
+                    try await withCheckedThrowingContinuation { continuation in
+                        self.waitForCapacity(continuation)
+                    }
+                },
+                onCancel: {
+                    self.dispose()
+                }
+            )
+        }
+    }
+
+    func finish(_ event: Event<Element>) {
+        _ = enqueue(event)
+    }
+
+    func dispose() {
+        let producer = lock.performLocked { () -> Producer? in
+            isDisposed = true
+            queue = Queue(capacity: 0)
+
+            let producer = self.producer
+            self.producer = nil
+            return producer
+        }
+
+        producer?.resume(throwing: CancellationError())
+    }
+
+    /// - returns: Number of elements waiting for delivery.
+    private func enqueue(_ event: Event<Element>) -> Int {
+        let (count, startDrain) = lock.performLocked { () -> (Int, Bool) in
+            if isDisposed {
+                return (0, false)
+            }
+
+            queue.enqueue(event)
+
+            let startDrain = !isDraining
+            isDraining = true
+            return (queue.count, startDrain)
+        }
+
+        if startDrain {
+            _ = scheduler.schedule(()) { _ in
+                self.drain()
+                return Disposables.create()
+            }
+        }
+
+        return count
+    }
+
+    private func waitForCapacity(_ continuation: Producer) {
+        let result = lock.performLocked { () -> Result<Void, Error>? in
+            if isDisposed {
+                return .failure(CancellationError())
+            }
+
+            if queue.count < capacity {
+                return .success(())
+            }
+
+            producer = continuation
+            return nil
+        }
+
+        if let result {
+            continuation.resume(with: result)
+        }
+    }
+
+    private func drain() {
+        while true {
+            let (event, producer) = lock.performLocked { () -> (Event<Element>?, Producer?) in
+                guard !isDisposed, let event = queue.dequeue() else {
+                    isDraining = false
+                    return (nil, nil)
+                }
+
+                let producer = self.producer
+                self.producer = nil
+                return (event, producer)
+            }
+
+            producer?.resume()
+
+            guard let event else {
+                return
+            }
+
+            observer.on(event)
+        }
+    }
 }
 #endif
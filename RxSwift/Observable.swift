@@ -25,6 +25,17 @@ public class Observable<Element>: ObservableType {
 
     public func asObservable() -> Observable<Element> { self }
 
+    /// Fuses a synchronous element stage into this sequence.
+    ///
+    /// Producers of synchronous element-wise operators (`map`, `filter`, `compactMap`, `scan`, `do(onNext:)`)
+    /// override this to return a single producer running both stages in one sink.
+    ///
+    /// - parameter makeStage: Creates the stage for a new subscription. `nil` result drops the element.
+    /// - returns: Fused sequence or `nil` in case this sequence can't be fused with.
+    func fused<Result>(with _: @escaping () -> ElementStage<Element, Result>) -> Observable<Result>? {
+        nil
+    }
+
     deinit {
         #if TRACE_RESOURCES
         _ = Resources.decrementTotal()
@@ -115,10 +115,14 @@ public extension ObservableType {
                 disposable.dispose()
             }
         }
-        return Disposables.create(
-            asObservable().subscribe(observer),
-            disposable
-        )
+        let subscription = asObservable().subscribe(observer)
+
+        // Without `onDisposed` there is nothing to dispose together with the subscription.
+        if Disposables.isNoOp(disposable) {
+            return subscription
+        }
+
+        return Disposables.create(subscription, disposable)
     }
 }
 
@@ -128,7 +132,7 @@ public extension Hooks {
     typealias DefaultErrorHandler = (_ subscriptionCallStack: [String], _ error: Error) -> Void
     typealias CustomCaptureSubscriptionCallstack = () -> [String]
 
-    private static let lock = RecursiveLock()
+    private static let lock = SpinLock()
     private static var _defaultErrorHandler: DefaultErrorHandler = { subscriptionCallStack, error in
         #if DEBUG
         let serializedCallStack = subscriptionCallStack.joined(separator: "\n")
@@ -52,6 +52,7 @@ private final class BufferTimeCountSink<Element, Observer: ObserverType>:
     Sink<Observer>,
     LockOwnerType,
     ObserverType,
+    BatchObserverType,
     SynchronizedOnType where Observer.Element == [Element]
 {
     typealias Parent = BufferTimeCount<Element>
@@ -111,6 +112,26 @@ private final class BufferTimeCountSink<Element, Observer: ObserverType>:
         }
     }
 
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        lock.performLocked {
+            self.synchronized_on(batch: elements.assumingElementType(Element.self))
+        }
+    }
+
+    private func synchronized_on(batch elements: UnsafeBufferPointer<Element>) {
+        var remaining = elements[...]
+        while !remaining.isEmpty, !isDisposed {
+            let capacity = parent.count - buffer.count
+            let chunk = capacity > 0 ? remaining.prefix(capacity) : remaining
+            buffer.append(contentsOf: chunk)
+            remaining = remaining[chunk.endIndex...]
+
+            if buffer.count == parent.count {
+                startNewWindowAndSendCurrentOne()
+            }
+        }
+    }
+
     func createTimer(_ windowID: Int) {
         if timerD.isDisposed {
             return
@@ -49,6 +49,9 @@ final class CombineLatestCollectionTypeSink<Collection: Swift.Collection, Observ
     // state
     var numberOfValues = 0
     var values: [SourceElement?]
+    // Once every source produced a value, latest values live here and are updated in place. It's only copied when the
+    // result selector keeps it. The `collections` benchmarks compare both cases.
+    var latest = [SourceElement]()
     var isDone: [Bool]
     var numberOfDone = 0
     var subscriptions: [SingleAssignmentDisposable]
@@ -71,23 +74,30 @@ final class CombineLatestCollectionTypeSink<Collection: Swift.Collection, Observ
         lock.lock(); defer { self.lock.unlock() }
         switch event {
         case let .next(element):
-            if values[atIndex] == nil {
-                numberOfValues += 1
-            }
+            if numberOfValues == parent.count {
+                latest[atIndex] = element
+            } else {
+                if values[atIndex] == nil {
+                    numberOfValues += 1
+                }
 
-            values[atIndex] = element
+                values[atIndex] = element
 
-            if numberOfValues < parent.count {
-                let numberOfOthersThatAreDone = numberOfDone - (isDone[atIndex] ? 1 : 0)
-                if numberOfOthersThatAreDone == parent.count - 1 {
-                    forwardOn(.completed)
-                    dispose()
+                if numberOfValues < parent.count {
+                    let numberOfOthersThatAreDone = numberOfDone - (isDone[atIndex] ? 1 : 0)
+                    if numberOfOthersThatAreDone == parent.count - 1 {
+                        forwardOn(.completed)
+                        dispose()
+                    }
+                    return
                 }
-                return
+
+                latest = values.map { $0! }
+                values = []
             }
 
             do {
-                let result = try parent.resultSelector(values.map { $0! })
+                let result = try parent.resultSelector(latest)
                 forwardOn(.next(result))
             } catch {
                 forwardOn(.error(error))
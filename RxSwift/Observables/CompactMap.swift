@@ -17,11 +17,13 @@ public extension ObservableType {
     func compactMap<Result>(_ transform: @escaping (Element) throws -> Result?)
         -> Observable<Result>
     {
-        CompactMap(source: asObservable(), transform: transform)
+        let source = asObservable()
+        return source.fused(with: { () -> ElementStage<Element, Result> in transform })
+            ?? CompactMap(source: source, transform: transform)
     }
 }
 
-private final class CompactMapSink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType {
+private final class CompactMapSink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType {
     typealias Transform = (SourceType) throws -> ResultType?
 
     typealias ResultType = Observer.Element
@@ -53,18 +55,24 @@ private final class CompactMapSink<SourceType, Observer: ObserverType>: Sink<Obs
             dispose()
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        forwardOn(batch: elements.assumingElementType(SourceType.self), stage: transform)
+    }
 }
 
-private final class CompactMap<SourceType, ResultType>: Producer<ResultType> {
+private final class CompactMap<SourceType, ResultType>: FusibleProducer<SourceType, ResultType> {
     typealias Transform = (SourceType) throws -> ResultType?
 
-    private let source: Observable<SourceType>
-
     private let transform: Transform
 
     init(source: Observable<SourceType>, transform: @escaping Transform) {
-        self.source = source
         self.transform = transform
+        super.init(source: source)
+    }
+
+    override func makeStage() -> ElementStage<SourceType, ResultType> {
+        transform
     }
 
     override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == ResultType {
@@ -0,0 +1,296 @@
+//
+//  ConcatMapEager.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+public extension ObservableType {
+    /**
+     Projects each element of an observable sequence to an observable sequence, subscribes to up to `maxConcurrent`
+     projected sequences at the same time and concatenates their elements in source order.
+
+     Elements of the oldest projected sequence are forwarded immediately. Elements of later sequences are buffered
+     until all sequences before them complete.
+
+     - seealso: [concat operator on reactivex.io](http://reactivex.io/documentation/operators/concat.html)
+
+     - parameter maxConcurrent: Maximum number of projected sequences that are subscribed to or buffered at the same time.
+     - parameter prefetch: Maximum number of elements buffered per projected sequence. If a sequence produces more elements while waiting for its turn, the resulting sequence fails with `RxError.bufferOverflow`.
+     - parameter selector: A transform function to apply to each element.
+     - returns: An observable sequence that contains the elements of each projected sequence, in source order.
+     */
+    func concatMapEager<Source: ObservableConvertibleType>(maxConcurrent: Int, prefetch: Int = Int.max, _ selector: @escaping (Element) throws -> Source)
+        -> Observable<Source.Element>
+    {
+        guard maxConcurrent > 0 else {
+            rxFatalError("maxConcurrent must be positive")
+        }
+
+        guard prefetch > 0 else {
+            rxFatalError("prefetch must be positive")
+        }
+
+        return ConcatMapEager(source: asObservable(), maxConcurrent: maxConcurrent, prefetch: prefetch, selector: selector)
+    }
+}
+
+private final class ConcatMapEagerInner<Element> {
+    let subscription = SingleAssignmentDisposable()
+    var disposeKey: CompositeDisposable.DisposeKey?
+
+    // state, guarded by the sink lock
+    var buffer = Queue<Element>(capacity: 1)
+    var isDone = false
+}
+
+private final class ConcatMapEagerInnerObserver<SourceElement, SourceSequence: ObservableConvertibleType, Observer: ObserverType>: ObserverType where Observer.Element == SourceSequence.Element {
+    typealias Element = Observer.Element
+    typealias Parent = ConcatMapEagerSink<SourceElement, SourceSequence, Observer>
+
+    private let parent: Parent
+    private let inner: ConcatMapEagerInner<Element>
+
+    init(parent: Parent, inner: ConcatMapEagerInner<Element>) {
+        self.parent = parent
+        self.inner = inner
+    }
+
+    func on(_ event: Event<Element>) {
+        parent.on(event, inner: inner)
+    }
+}
+
+private final class ConcatMapEagerSink<SourceElement, SourceSequence: ObservableConvertibleType, Observer: ObserverType>:
+    Sink<Observer>,
+    ObserverType where Observer.Element == SourceSequence.Element
+{
+    typealias Element = SourceElement
+    typealias ResultElement = Observer.Element
+    typealias Selector = (SourceElement) throws -> SourceSequence
+    typealias Inner = ConcatMapEagerInner<ResultElement>
+
+    private enum DrainAction {
+        case stop
+        case subscribe(SourceSequence, Inner)
+        case deliver
+        case terminate(Event<ResultElement>)
+    }
+
+    private let selector: Selector
+    private let maxConcurrent: Int
+    private let prefetch: Int
+
+    private let lock = SpinLock()
+
+    // state
+    private var isDraining = false
+    private var pending = Queue<SourceSequence>(capacity: 2)
+    private var inners = Queue<Inner>(capacity: 2)
+    private var isSourceDone = false
+    private var error: Swift.Error?
+
+    // only touched by the draining thread
+    private var delivering = ContiguousArray<ResultElement>()
+
+    private let sourceSubscription = SingleAssignmentDisposable()
+    private let group = CompositeDisposable()
+
+    init(selector: @escaping Selector, maxConcurrent: Int, prefetch: Int, observer: Observer, cancel: Cancelable) {
+        self.selector = selector
+        self.maxConcurrent = maxConcurrent
+        self.prefetch = prefetch
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func run(_ source: Observable<SourceElement>) -> Disposable {
+        _ = group.insert(sourceSubscription)
+        sourceSubscription.setDisposable(source.subscribe(self))
+        return group
+    }
+
+    func on(_ event: Event<SourceElement>) {
+        switch event {
+        case let .next(element):
+            do {
+                let sequence = try selector(element)
+                lock.performLocked {
+                    self.pending.enqueue(sequence)
+                }
+            } catch {
+                fail(error)
+            }
+        case let .error(error):
+            fail(error)
+        case .completed:
+            lock.performLocked {
+                self.isSourceDone = true
+            }
+        }
+
+        tryDrain()
+    }
+
+    func on(_ event: Event<ResultElement>, inner: Inner) {
+        switch event {
+        case let .next(element):
+            let forwardDirectly = lock.performLocked { () -> Bool in
+                // The oldest sequence can skip the buffer if nobody else is delivering.
+                if !self.isDraining, inner.buffer.isEmpty, self.inners.first === inner {
+                    self.isDraining = true
+                    return true
+                }
+
+                // The head is delivered by the drainer as soon as it's done with it, e.g. right after subscribing
+                // to a head that emits synchronously, so only sequences waiting for their turn are limited.
+                if self.inners.first !== inner, inner.buffer.count >= self.prefetch {
+                    self.error = self.error ?? RxError.bufferOverflow
+                } else {
+                    inner.buffer.enqueue(element)
+                }
+                return false
+            }
+
+            if forwardDirectly {
+                forwardOn(event)
+                drain()
+                return
+            }
+        case let .error(error):
+            fail(error)
+        case .completed:
+            lock.performLocked {
+                inner.isDone = true
+            }
+            if let disposeKey = inner.disposeKey {
+                group.remove(for: disposeKey)
+            }
+        }
+
+        tryDrain()
+    }
+
+    private func fail(_ error: Swift.Error) {
+        lock.performLocked {
+            if self.error == nil {
+                self.error = error
+            }
+        }
+    }
+
+    private func tryDrain() {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            if self.isDraining {
+                return false
+            }
+            self.isDraining = true
+            return true
+        }
+
+        if shouldDrain {
+            drain()
+        }
+    }
+
+    /// Subscribes to pending sequences and delivers buffered elements in order.
+    ///
+    /// Only one thread drains at a time, others just update state and leave the work to it. Inner sequences that
+    /// produce elements or complete synchronously while being subscribed to don't recurse, so no trampolining
+    /// is needed.
+    private func drain() {
+        while !isDisposed {
+            let action = lock.performLocked { () -> DrainAction in
+                if let error = self.error {
+                    return .terminate(.error(error))
+                }
+
+                if self.inners.count < self.maxConcurrent, let sequence = self.pending.dequeue() {
+                    let inner = Inner()
+                    self.inners.enqueue(inner)
+                    return .subscribe(sequence, inner)
+                }
+
+                while let head = self.inners.first {
+                    while let element = head.buffer.dequeue() {
+                        self.delivering.append(element)
+                    }
+
+                    if !self.delivering.isEmpty {
+                        return .deliver
+                    }
+
+                    if !head.isDone {
+                        break
+                    }
+
+                    _ = self.inners.dequeue()
+                    if let sequence = self.pending.dequeue() {
+                        let inner = Inner()
+                        self.inners.enqueue(inner)
+                        return .subscribe(sequence, inner)
+                    }
+                }
+
+                if self.isSourceDone, self.inners.isEmpty, self.pending.isEmpty {
+                    return .terminate(.completed)
+                }
+
+                self.isDraining = false
+                return .stop
+            }
+
+            switch action {
+            case .stop:
+                return
+            case let .subscribe(sequence, inner):
+                subscribe(sequence, inner: inner)
+            case .deliver:
+                delivering.withUnsafeBufferPointer { forwardOn(batch: $0) }
+                delivering.removeAll(keepingCapacity: true)
+            case let .terminate(event):
+                forwardOn(event)
+                dispose()
+                return
+            }
+        }
+    }
+
+    private func subscribe(_ sequence: SourceSequence, inner: Inner) {
+        guard let disposeKey = group.insert(inner.subscription) else {
+            return
+        }
+
+        inner.disposeKey = disposeKey
+        let observer = ConcatMapEagerInnerObserver(parent: self, inner: inner)
+        inner.subscription.setDisposable(sequence.asObservable().subscribe(observer))
+    }
+}
+
+private extension Queue {
+    var first: T? {
+        isEmpty ? nil : peek()
+    }
+}
+
+private final class ConcatMapEager<SourceElement, SourceSequence: ObservableConvertibleType>: Producer<SourceSequence.Element> {
+    typealias Selector = (SourceElement) throws -> SourceSequence
+
+    private let source: Observable<SourceElement>
+    private let maxConcurrent: Int
+    private let prefetch: Int
+    private let selector: Selector
+
+    init(source: Observable<SourceElement>, maxConcurrent: Int, prefetch: Int, selector: @escaping Selector) {
+        self.source = source
+        self.maxConcurrent = maxConcurrent
+        self.prefetch = prefetch
+        self.selector = selector
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == SourceSequence.Element {
+        let sink = ConcatMapEagerSink(selector: selector, maxConcurrent: maxConcurrent, prefetch: prefetch, observer: observer, cancel: cancel)
+        let subscription = sink.run(source)
+        return (sink: sink, subscription: subscription)
+    }
+}
@@ -26,9 +26,6 @@ private final class AnonymousObservableSink<Observer: ObserverType>: Sink<Observ
     typealias Element = Observer.Element
     typealias Parent = AnonymousObservable<Element>
 
-    // state
-    private let isStopped = AtomicInt(0)
-
     #if DEBUG
     private let synchronizationTracker = SynchronizationTracker()
     #endif
@@ -44,12 +41,12 @@ private final class AnonymousObservableSink<Observer: ObserverType>: Sink<Observ
         #endif
         switch event {
         case .next:
-            if load(isStopped) == 1 {
+            if isTerminated {
                 return
             }
             forwardOn(event)
         case .error, .completed:
-            if fetchOr(isStopped, 1) == 0 {
+            if markTerminated() {
                 forwardOn(event)
                 dispose()
             }
@@ -23,6 +23,31 @@ public extension ObservableType where Element == Data {
     ) -> Observable<Item> {
         map { try decoder.decode(type, from: $0) }
     }
+
+    /// Attempt to decode the emitted `Data` using a provided decoder, decoding up to `maxConcurrent` values in parallel.
+    ///
+    /// Decoded values are emitted in the order of the source elements. The sequence fails with the first decoding error.
+    ///
+    /// - parameter type: A `Decodable`-conforming type to attempt to decode to
+    /// - parameter decoder: A capable decoder, e.g. `JSONDecoder` or `PropertyListDecoder`. It's used from several threads at once, so it must be thread safe.
+    /// - parameter scheduler: Scheduler to decode on. A concurrent scheduler like `WorkStealingScheduler` is required to actually decode in parallel.
+    /// - parameter maxConcurrent: Maximum number of values decoded at the same time, defaults to the number of active processors.
+    ///
+    /// - returns: An `Observable` of the decoded type
+    func decode<Item: Decodable>(
+        type: Item.Type,
+        decoder: some DataDecoder,
+        scheduler: ImmediateSchedulerType,
+        maxConcurrent: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> Observable<Item> {
+        guard maxConcurrent > 0 else {
+            rxFatalError("maxConcurrent must be positive")
+        }
+
+        return parallel(on: scheduler, rails: maxConcurrent)
+            .map { try decoder.decode(type, from: $0) }
+            .sequential(ordered: true)
+    }
 }
 
 /// Represents an entity capable of decoding raw `Data`
@@ -50,6 +50,8 @@ private final class DelaySink<Observer: ObserverType>:
     // state
     private var queue = Queue<(eventTime: RxTime, event: Event<Element>)>(capacity: 0)
 
+    private let metrics = Metrics.register("delay")
+
     init(observer: Observer, dueTime: RxTimeInterval, scheduler: SchedulerType, cancel: Cancelable) {
         self.dueTime = dueTime
         self.scheduler = scheduler
@@ -81,6 +83,7 @@ private final class DelaySink<Observer: ObserverType>:
 
             let eventToForwardImmediately = ranAtLeastOnce ? nil : queue.dequeue()?.event
             let nextEventToScheduleOriginalTime: Date? = ranAtLeastOnce && !queue.isEmpty ? queue.peek().eventTime : nil
+            metrics?.buffered(queue.count)
 
             if errorEvent == nil {
                 if eventToForwardImmediately != nil {}
@@ -105,6 +108,7 @@ private final class DelaySink<Observer: ObserverType>:
                         dispose()
                         return
                     }
+                    metrics?.sent()
                 } else if let nextEventToScheduleOriginalTime {
                     scheduler.schedule((), dueTime: dueTime.reduceWithSpanBetween(earlierDate: nextEventToScheduleOriginalTime, laterDate: self.scheduler.now))
                     return
@@ -126,6 +130,7 @@ private final class DelaySink<Observer: ObserverType>:
             let shouldSendImmediately = !running
             queue = Queue(capacity: 0)
             errorEvent = event
+            metrics?.buffered(0)
             lock.unlock()
 
             if shouldSendImmediately {
@@ -137,6 +142,10 @@ private final class DelaySink<Observer: ObserverType>:
             let shouldSchedule = !active
             active = true
             queue.enqueue((scheduler.now, event))
+            if case .next = event {
+                metrics?.received()
+            }
+            metrics?.buffered(queue.count)
             lock.unlock()
 
             if shouldSchedule {
@@ -26,7 +26,20 @@ public extension ObservableType {
     func `do`(onNext: ((Element) throws -> Void)? = nil, afterNext: ((Element) throws -> Void)? = nil, onError: ((Swift.Error) throws -> Void)? = nil, afterError: ((Swift.Error) throws -> Void)? = nil, onCompleted: (() throws -> Void)? = nil, afterCompleted: (() throws -> Void)? = nil, onSubscribe: (() -> Void)? = nil, onSubscribed: (() -> Void)? = nil, onDispose: (() -> Void)? = nil)
         -> Observable<Element>
     {
-        Do(source: asObservable(), eventHandler: { e in
+        if let onNext, afterNext == nil, onError == nil, afterError == nil, onCompleted == nil, afterCompleted == nil, onSubscribe == nil, onSubscribed == nil, onDispose == nil {
+            // Only `onNext` is a synchronous element stage that can be fused with neighbouring operators.
+            let source = asObservable()
+            let makeStage = { () -> ElementStage<Element, Element> in
+                { element in
+                    try onNext(element)
+                    return element
+                }
+            }
+            return source.fused(with: makeStage)
+                ?? FusedProducer(source: source, makeStage: makeStage)
+        }
+
+        return Do(source: asObservable(), eventHandler: { e in
             switch e {
             case let .next(element):
                 try onNext?(element)
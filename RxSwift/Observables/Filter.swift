@@ -18,7 +18,9 @@ public extension ObservableType {
     func filter(_ predicate: @escaping (Element) throws -> Bool)
         -> Observable<Element>
     {
-        Filter(source: asObservable(), predicate: predicate)
+        let source = asObservable()
+        return source.fused(with: { () -> ElementStage<Element, Element> in { try predicate($0) ? $0 : nil } })
+            ?? Filter(source: source, predicate: predicate)
     }
 }
 
@@ -37,7 +39,7 @@ public extension ObservableType {
     }
 }
 
-private final class FilterSink<Observer: ObserverType>: Sink<Observer>, ObserverType {
+private final class FilterSink<Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType {
     typealias Predicate = (Element) throws -> Bool
     typealias Element = Observer.Element
 
@@ -65,17 +67,26 @@ private final class FilterSink<Observer: ObserverType>: Sink<Observer>, Observer
             dispose()
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        let predicate = predicate
+        forwardOn(batch: elements.assumingElementType(Element.self)) { try predicate($0) ? $0 : nil }
+    }
 }
 
-private final class Filter<Element>: Producer<Element> {
+private final class Filter<Element>: FusibleProducer<Element, Element> {
     typealias Predicate = (Element) throws -> Bool
 
-    private let source: Observable<Element>
     private let predicate: Predicate
 
     init(source: Observable<Element>, predicate: @escaping Predicate) {
-        self.source = source
         self.predicate = predicate
+        super.init(source: source)
+    }
+
+    override func makeStage() -> ElementStage<Element, Element> {
+        let predicate = predicate
+        return { try predicate($0) ? $0 : nil }
     }
 
     override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
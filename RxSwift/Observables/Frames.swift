@@ -0,0 +1,221 @@
+//
+//  Frames.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+
+/// The way frames are delimited in a byte stream.
+public enum DataFraming {
+    /// Frames are terminated by `delimiter`, which isn't part of the frame.
+    case delimited(by: UInt8)
+
+    /// Every frame is preceded by its length in bytes, encoded as a big-endian unsigned integer of `headerSize` bytes.
+    case lengthPrefixed(headerSize: Int)
+
+    /// Frames are terminated by `\n`, e.g. JSON Lines.
+    public static var newlineDelimited: DataFraming {
+        .delimited(by: UInt8(ascii: "\n"))
+    }
+}
+
+/// Errors produced by `frames(_:maxFrameLength:)`.
+public enum DataFramingError: Swift.Error, CustomDebugStringConvertible {
+    /// A frame is longer than the maximum frame length.
+    case frameTooLong(length: Int)
+
+    /// The source completed in the middle of a length-prefixed frame.
+    case truncatedFrame
+
+    public var debugDescription: String {
+        switch self {
+        case let .frameTooLong(length):
+            return "Frame of \(length) bytes is longer than the maximum frame length."
+        case .truncatedFrame:
+            return "Sequence completed in the middle of a frame."
+        }
+    }
+}
+
+public extension ObservableType where Element == Data {
+    /**
+     Splits a stream of arbitrary chunks of bytes into frames.
+
+     A frame that lies within a single chunk is emitted as a slice of that chunk, without copying its bytes. Only
+     frames that span several chunks are copied together. Slices share the storage of the original chunk, so their
+     `startIndex` isn't necessarily `0`.
+
+     With `.delimited(by:)`, bytes after the last delimiter are emitted as the last frame when the source completes.
+     With `.lengthPrefixed(headerSize:)`, the sequence fails with `DataFramingError.truncatedFrame` if the source
+     completes in the middle of a frame.
+
+     - parameter framing: The way frames are delimited.
+     - parameter maxFrameLength: Maximum length of a frame. The sequence fails with `DataFramingError.frameTooLong` when a frame is longer.
+     - returns: An observable sequence of frames, in source order.
+     */
+    func frames(_ framing: DataFraming, maxFrameLength: Int = Int.max) -> Observable<Data> {
+        if case let .lengthPrefixed(headerSize) = framing, !(1 ... 8).contains(headerSize) {
+            rxFatalError("headerSize must be between 1 and 8")
+        }
+
+        guard maxFrameLength >= 0 else {
+            rxFatalError("maxFrameLength can't be negative")
+        }
+
+        return Frames(source: asObservable(), framing: framing, maxFrameLength: maxFrameLength)
+    }
+}
+
+private final class FramesSink<Observer: ObserverType>: Sink<Observer>, ObserverType where Observer.Element == Data {
+    typealias Element = Data
+
+    private let framing: DataFraming
+    private let maxFrameLength: Int
+
+    // state
+    // Bytes of a frame, or of a length header, that started in an earlier chunk.
+    private var partial = Data()
+    // Length of the current frame, once its header was read.
+    private var frameLength: Int?
+
+    init(framing: DataFraming, maxFrameLength: Int, observer: Observer, cancel: Cancelable) {
+        self.framing = framing
+        self.maxFrameLength = maxFrameLength
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func on(_ event: Event<Data>) {
+        switch event {
+        case let .next(chunk):
+            do {
+                switch framing {
+                case let .delimited(delimiter):
+                    try split(chunk, delimiter: delimiter)
+                case let .lengthPrefixed(headerSize):
+                    try split(chunk, headerSize: headerSize)
+                }
+            } catch {
+                forwardOn(.error(error))
+                dispose()
+            }
+        case let .error(error):
+            forwardOn(.error(error))
+            dispose()
+        case .completed:
+            switch framing {
+            case .delimited:
+                if !partial.isEmpty {
+                    forwardOn(.next(takePartial()))
+                }
+            case .lengthPrefixed:
+                if frameLength != nil || !partial.isEmpty {
+                    forwardOn(.error(DataFramingError.truncatedFrame))
+                    dispose()
+                    return
+                }
+            }
+            forwardOn(.completed)
+            dispose()
+        }
+    }
+
+    private func split(_ chunk: Data, delimiter: UInt8) throws {
+        var start = chunk.startIndex
+
+        while !isDisposed, let end = chunk[start...].firstIndex(of: delimiter) {
+            try checkLength(partial.count + (end - start))
+
+            if partial.isEmpty {
+                forwardOn(.next(chunk[start ..< end]))
+            } else {
+                partial.append(chunk[start ..< end])
+                forwardOn(.next(takePartial()))
+            }
+
+            start = end + 1
+        }
+
+        if start < chunk.endIndex {
+            try checkLength(partial.count + (chunk.endIndex - start))
+            partial.append(chunk[start...])
+        }
+    }
+
+    private func split(_ chunk: Data, headerSize: Int) throws {
+        var index = chunk.startIndex
+
+        while !isDisposed {
+            let length: Int
+            if let frameLength {
+                length = frameLength
+            } else {
+                guard let header = take(headerSize, from: chunk, at: &index) else {
+                    return
+                }
+                length = header.reduce(0) { $0 << 8 | Int($1) }
+                // Doesn't fit into `Int` if negative.
+                if length < 0 {
+                    throw DataFramingError.frameTooLong(length: Int.max)
+                }
+                try checkLength(length)
+                frameLength = length
+            }
+
+            guard let frame = take(length, from: chunk, at: &index) else {
+                return
+            }
+            frameLength = nil
+            forwardOn(.next(frame))
+        }
+    }
+
+    /// Takes `count` bytes, starting with the bytes of `partial` and continuing with `chunk` at `index`.
+    ///
+    /// - returns: `count` bytes, or `nil` if `chunk` ended before that and its remaining bytes were moved to `partial`.
+    private func take(_ count: Int, from chunk: Data, at index: inout Data.Index) -> Data? {
+        let available = chunk.endIndex - index
+
+        if partial.isEmpty, available >= count {
+            defer { index += count }
+            return chunk[index ..< index + count]
+        }
+
+        let needed = Swift.min(count - partial.count, available)
+        partial.append(chunk[index ..< index + needed])
+        index += needed
+
+        return partial.count == count ? takePartial() : nil
+    }
+
+    private func takePartial() -> Data {
+        defer { partial = Data() }
+        return partial
+    }
+
+    private func checkLength(_ length: Int) throws {
+        if length > maxFrameLength {
+            throw DataFramingError.frameTooLong(length: length)
+        }
+    }
+}
+
+private final class Frames: Producer<Data> {
+    private let source: Observable<Data>
+    private let framing: DataFraming
+    private let maxFrameLength: Int
+
+    init(source: Observable<Data>, framing: DataFraming, maxFrameLength: Int) {
+        self.source = source
+        self.framing = framing
+        self.maxFrameLength = maxFrameLength
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Data {
+        let sink = FramesSink(framing: framing, maxFrameLength: maxFrameLength, observer: observer, cancel: cancel)
+        let subscription = source.subscribe(sink)
+        return (sink: sink, subscription: subscription)
+    }
+}
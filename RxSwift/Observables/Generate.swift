@@ -38,7 +38,7 @@ private final class GenerateSink<Sequence, Observer: ObserverType>: Sink<Observe
     }
 
     func run() -> Disposable {
-        parent.scheduler.scheduleRecursive(true) { isFirst, recurse in
+        parent.scheduler.scheduleRecursiveLoop(true) { isFirst, recurse in
             do {
                 if !isFirst {
                     self.state = try self.parent.iterate(self.state)
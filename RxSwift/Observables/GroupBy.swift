@@ -18,70 +18,267 @@ public extension ObservableType {
     func groupBy<Key: Hashable>(keySelector: @escaping (Element) throws -> Key)
         -> Observable<GroupedObservable<Key, Element>>
     {
-        GroupBy(source: asObservable(), selector: keySelector)
+        GroupBy(source: asObservable(), selector: keySelector, expiration: nil, maxGroups: Int.max)
+    }
+
+    /**
+     Groups the elements of an observable sequence according to a specified key selector function, keeping at most `maxGroups` groups open.
+
+     When an element with a new key arrives while `maxGroups` groups are open, the group that received an element least recently is completed
+     and evicted first. An element with the key of an evicted group opens a new group for that key.
+
+     - seealso: [groupBy operator on reactivex.io](http://reactivex.io/documentation/operators/groupby.html)
+
+     - parameter keySelector: A function to extract the key for each element.
+     - parameter maxGroups: Maximum number of open groups.
+     - returns: A sequence of observable groups, each of which corresponds to a key value, containing elements that share that same key value.
+     */
+    func groupBy<Key: Hashable>(keySelector: @escaping (Element) throws -> Key, maxGroups: Int)
+        -> Observable<GroupedObservable<Key, Element>>
+    {
+        GroupBy(source: asObservable(), selector: keySelector, expiration: nil, maxGroups: maxGroups)
+    }
+
+    /**
+     Groups the elements of an observable sequence according to a specified key selector function, completing and evicting groups that
+     didn't receive an element for `expireAfter` time.
+
+     When an element with a new key arrives while `maxGroups` groups are open, the group that received an element least recently is completed
+     and evicted first. An element with the key of an evicted group opens a new group for that key.
+
+     Memory used by the operator is proportional to the number of open groups, not to the number of keys seen.
+
+     - seealso: [groupBy operator on reactivex.io](http://reactivex.io/documentation/operators/groupby.html)
+
+     - parameter keySelector: A function to extract the key for each element.
+     - parameter expireAfter: Time without elements after which a group is completed and evicted.
+     - parameter maxGroups: Maximum number of open groups.
+     - parameter scheduler: Scheduler to run expiration timers on.
+     - returns: A sequence of observable groups, each of which corresponds to a key value, containing elements that share that same key value.
+     */
+    func groupBy<Key: Hashable>(keySelector: @escaping (Element) throws -> Key, expireAfter: RxTimeInterval, maxGroups: Int = Int.max, scheduler: SchedulerType)
+        -> Observable<GroupedObservable<Key, Element>>
+    {
+        GroupBy(source: asObservable(), selector: keySelector, expiration: (expireAfter, scheduler), maxGroups: maxGroups)
     }
 }
 
-private final class GroupedObservableImpl<Element>: Observable<Element> {
-    private var subject: PublishSubject<Element>
-    private var refCount: RefCountDisposable
+/// Source of a single group. Unlike `PublishSubject`, it has no reentrancy checks or recursive lock, and
+/// doesn't allocate anything beyond itself for the first observer.
+private final class GroupEmitter<Element>:
+    Observable<Element>,
+    SynchronizedUnsubscribeType
+{
+    typealias Observers = AnyObserver<Element>.s
+    typealias DisposeKey = Observers.KeyType
+
+    private let lock = SpinLock()
+    private let refCount: RefCountDisposable
+
+    // state
+    private var observers = Observers()
+    private var stoppedEvent: Event<Element>?
 
-    init(subject: PublishSubject<Element>, refCount: RefCountDisposable) {
-        self.subject = subject
+    init(refCount: RefCountDisposable) {
         self.refCount = refCount
     }
 
+    func on(_ event: Event<Element>) {
+        dispatch(lock.performLocked { self.synchronized_on(event) }, event)
+    }
+
+    private func synchronized_on(_ event: Event<Element>) -> Observers {
+        if stoppedEvent != nil {
+            return Observers()
+        }
+
+        switch event {
+        case .next:
+            return observers
+        case .error, .completed:
+            stoppedEvent = event
+            let observers = observers
+            self.observers.removeAll()
+            return observers
+        }
+    }
+
     override func subscribe<Observer: ObserverType>(_ observer: Observer) -> Disposable where Observer.Element == Element {
         let release = refCount.retain()
-        let subscription = subject.subscribe(observer)
-        return Disposables.create(release, subscription)
+
+        let (disposeKey, stoppedEvent) = lock.performLocked { () -> (DisposeKey?, Event<Element>?) in
+            if let stoppedEvent = self.stoppedEvent {
+                return (nil, stoppedEvent)
+            }
+            return (self.observers.insert(observer.on), nil)
+        }
+
+        guard let disposeKey else {
+            observer.on(stoppedEvent!)
+            return release
+        }
+
+        return Disposables.create(release, SubscriptionDisposable(owner: self, key: disposeKey))
+    }
+
+    func synchronizedUnsubscribe(_ disposeKey: DisposeKey) {
+        lock.performLocked {
+            _ = self.observers.removeKey(disposeKey)
+        }
+    }
+}
+
+private final class GroupState<Key, Element> {
+    let key: Key
+    let emitter: GroupEmitter<Element>
+
+    // Groups ordered by last activity, only maintained when groups are bounded. Groups are owned by the group table.
+    var lastActivity: RxTime?
+    unowned(unsafe) var previous: GroupState<Key, Element>?
+    unowned(unsafe) var next: GroupState<Key, Element>?
+
+    init(key: Key, emitter: GroupEmitter<Element>) {
+        self.key = key
+        self.emitter = emitter
     }
 }
 
 private final class GroupBySink<Key: Hashable, Element, Observer: ObserverType>:
     Sink<Observer>,
-    ObserverType where Observer.Element == GroupedObservable<Key, Element>
+    LockOwnerType,
+    ObserverType,
+    SynchronizedOnType where Observer.Element == GroupedObservable<Key, Element>
 {
     typealias ResultType = Observer.Element
     typealias Parent = GroupBy<Key, Element>
+    typealias Group = GroupState<Key, Element>
+
+    let lock = RecursiveLock()
 
     private let parent: Parent
     private let subscription = SingleAssignmentDisposable()
+    private let expirationTimer = SerialDisposable()
     private var refCountDisposable: RefCountDisposable!
-    private var groupedSubjectTable: [Key: PublishSubject<Element>]
+
+    // state
+    private var groups: [Key: Group]
+    private var leastRecentlyActive: Group?
+    private var mostRecentlyActive: Group?
+    private var isExpirationScheduled = false
 
     init(parent: Parent, observer: Observer, cancel: Cancelable) {
         self.parent = parent
-        groupedSubjectTable = [Key: PublishSubject<Element>]()
+        groups = [Key: Group]()
         super.init(observer: observer, cancel: cancel)
     }
 
     func run() -> Disposable {
         refCountDisposable = RefCountDisposable(disposable: subscription)
 
-        subscription.setDisposable(parent.source.subscribe(self))
+        subscription.setDisposable(Disposables.create(parent.source.subscribe(self), expirationTimer))
 
         return refCountDisposable
     }
 
     private func onGroupEvent(key: Key, value: Element) {
-        if let writer = groupedSubjectTable[key] {
-            writer.on(.next(value))
+        if let group = groups[key] {
+            touch(group)
+            group.emitter.on(.next(value))
         } else {
-            let writer = PublishSubject<Element>()
-            groupedSubjectTable[key] = writer
+            if groups.count >= parent.maxGroups, let evicted = leastRecentlyActive {
+                evict(evicted)
+            }
+
+            let group = Group(key: key, emitter: GroupEmitter(refCount: refCountDisposable))
+            groups[key] = group
+            touch(group)
 
-            let group = GroupedObservable(
-                key: key,
-                source: GroupedObservableImpl(subject: writer, refCount: refCountDisposable)
-            )
+            forwardOn(.next(GroupedObservable(key: key, source: group.emitter)))
+            group.emitter.on(.next(value))
+        }
+    }
 
-            forwardOn(.next(group))
-            writer.on(.next(value))
+    private func touch(_ group: Group) {
+        guard parent.isBounded else {
+            return
+        }
+
+        if let expiration = parent.expiration {
+            group.lastActivity = expiration.scheduler.now
+        }
+
+        if mostRecentlyActive !== group {
+            unlink(group)
+            group.previous = mostRecentlyActive
+            mostRecentlyActive?.next = group
+            mostRecentlyActive = group
+            if leastRecentlyActive == nil {
+                leastRecentlyActive = group
+            }
+        }
+
+        // After linking, so a group that is the only one open arms the timer too.
+        scheduleExpiration()
+    }
+
+    private func unlink(_ group: Group) {
+        if leastRecentlyActive === group {
+            leastRecentlyActive = group.next
+        }
+        if mostRecentlyActive === group {
+            mostRecentlyActive = group.previous
         }
+        group.previous?.next = group.next
+        group.next?.previous = group.previous
+        group.previous = nil
+        group.next = nil
     }
 
-    final func on(_ event: Event<Element>) {
+    private func evict(_ group: Group) {
+        unlink(group)
+        groups.removeValue(forKey: group.key)
+        group.emitter.on(.completed)
+    }
+
+    private func scheduleExpiration() {
+        guard !isExpirationScheduled, let expiration = parent.expiration, let oldest = leastRecentlyActive?.lastActivity else {
+            return
+        }
+
+        isExpirationScheduled = true
+        let scheduler = expiration.scheduler
+        let dueTime = expiration.interval.reduceWithSpanBetween(earlierDate: oldest, laterDate: scheduler.now)
+        expirationTimer.disposable = scheduler.scheduleRelative(self, dueTime: dueTime) { sink in
+            sink.lock.performLocked { sink.expireGroups() }
+            return Disposables.create()
+        }
+    }
+
+    private func expireGroups() {
+        isExpirationScheduled = false
+
+        guard let expiration = parent.expiration else {
+            return
+        }
+
+        let now = expiration.scheduler.now
+        while let oldest = leastRecentlyActive, let lastActivity = oldest.lastActivity, lastActivity.addingDispatchInterval(expiration.interval) <= now {
+            evict(oldest)
+        }
+
+        scheduleExpiration()
+    }
+
+    func on(_ event: Event<Element>) {
+        // Source events are already serialized, only expiration timers need the lock.
+        if parent.expiration == nil {
+            synchronized_on(event)
+        } else {
+            synchronizedOn(event)
+        }
+    }
+
+    func synchronized_on(_ event: Event<Element>) {
         switch event {
         case let .next(value):
             do {
@@ -109,8 +306,13 @@ private final class GroupBySink<Key: Hashable, Element, Observer: ObserverType>:
     }
 
     final func forwardOnGroups(event: Event<Element>) {
-        for writer in groupedSubjectTable.values {
-            writer.on(event)
+        let groups = groups.values
+        self.groups = [:]
+        leastRecentlyActive = nil
+        mostRecentlyActive = nil
+
+        for group in groups {
+            group.emitter.on(event)
         }
     }
 }
@@ -120,10 +322,18 @@ private final class GroupBy<Key: Hashable, Element>: Producer<GroupedObservable<
 
     fileprivate let source: Observable<Element>
     fileprivate let selector: KeySelector
+    fileprivate let expiration: (interval: RxTimeInterval, scheduler: SchedulerType)?
+    fileprivate let maxGroups: Int
+
+    // Groups are ordered by activity only when they can be evicted.
+    fileprivate let isBounded: Bool
 
-    init(source: Observable<Element>, selector: @escaping KeySelector) {
+    init(source: Observable<Element>, selector: @escaping KeySelector, expiration: (interval: RxTimeInterval, scheduler: SchedulerType)?, maxGroups: Int) {
         self.source = source
         self.selector = selector
+        self.expiration = expiration
+        self.maxGroups = Swift.max(maxGroups, 1)
+        isBounded = expiration != nil || maxGroups != Int.max
     }
 
     override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == GroupedObservable<Key, Element> {
@@ -0,0 +1,75 @@
+//
+//  Instrument.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+public extension ObservableType {
+    /**
+     Tags metrics of this subscription with `name` while `Metrics.isEnabled` is `true`.
+
+     The subscription itself is reported as the `instrument` operator of `name`, which counts subscriptions
+     and elements that reach the observer. Operators of the source sequence that are subscribed synchronously
+     as part of this subscription report into entries named `name` too, unless a nested `instrument` applies
+     a different name.
+
+     When metrics are disabled at the time of subscription, the source sequence is subscribed to directly.
+
+     - parameter name: Name that tags the metrics entries.
+     - returns: The source sequence.
+     */
+    func instrument(_ name: String) -> Observable<Element> {
+        Instrument(source: asObservable(), name: name)
+    }
+}
+
+private final class InstrumentSink<Observer: ObserverType>: Sink<Observer>, ObserverType {
+    typealias Element = Observer.Element
+
+    private let metrics: OperatorMetrics
+
+    init(metrics: OperatorMetrics, observer: Observer, cancel: Cancelable) {
+        self.metrics = metrics
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func on(_ event: Event<Element>) {
+        switch event {
+        case .next:
+            metrics.received()
+            forwardOn(event)
+            metrics.sent()
+        case .error, .completed:
+            forwardOn(event)
+            dispose()
+        }
+    }
+}
+
+private final class Instrument<Element>: Producer<Element> {
+    private let source: Observable<Element>
+    private let name: String
+
+    init(source: Observable<Element>, name: String) {
+        self.source = source
+        self.name = name
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        guard Metrics.isEnabled else {
+            return (sink: Disposables.create(), subscription: source.subscribe(observer))
+        }
+
+        return Metrics.tagging(name) {
+            guard let metrics = Metrics.register("instrument") else {
+                return (sink: Disposables.create(), subscription: self.source.subscribe(observer))
+            }
+
+            let sink = InstrumentSink(metrics: metrics, observer: observer, cancel: cancel)
+            let subscription = self.source.subscribe(sink)
+            return (sink: sink, subscription: subscription)
+        }
+    }
+}
@@ -19,11 +19,13 @@ public extension ObservableType {
     func map<Result>(_ transform: @escaping (Element) throws -> Result)
         -> Observable<Result>
     {
-        Map(source: asObservable(), transform: transform)
+        let source = asObservable()
+        return source.fused(with: { () -> ElementStage<Element, Result> in { try transform($0) } })
+            ?? Map(source: source, transform: transform)
     }
 }
 
-private final class MapSink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType {
+private final class MapSink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType {
     typealias Transform = (SourceType) throws -> ResultType
 
     typealias ResultType = Observer.Element
@@ -53,18 +55,26 @@ private final class MapSink<SourceType, Observer: ObserverType>: Sink<Observer>,
             dispose()
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        let transform = transform
+        forwardOn(batch: elements.assumingElementType(SourceType.self)) { try transform($0) }
+    }
 }
 
-private final class Map<SourceType, ResultType>: Producer<ResultType> {
+private final class Map<SourceType, ResultType>: FusibleProducer<SourceType, ResultType> {
     typealias Transform = (SourceType) throws -> ResultType
 
-    private let source: Observable<SourceType>
-
     private let transform: Transform
 
     init(source: Observable<SourceType>, transform: @escaping Transform) {
-        self.source = source
         self.transform = transform
+        super.init(source: source)
+    }
+
+    override func makeStage() -> ElementStage<SourceType, ResultType> {
+        let transform = transform
+        return { try transform($0) }
     }
 
     override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == ResultType {
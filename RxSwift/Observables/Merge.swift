@@ -153,7 +153,9 @@ private final class MergeLimitedSinkIter<SourceElement, SourceSequence: Observab
     func on(_ event: Event<Element>) {
         switch event {
         case .next:
+            parent.metrics?.received()
             parent.synchronizedForwardOn(event)
+            parent.metrics?.sent()
         case .error:
             parent.synchronizedForwardOnAndDispose(event)
         case .completed:
@@ -204,6 +206,9 @@ private class MergeLimitedSink<SourceElement, SourceSequence: ObservableConverti
     let sourceSubscription = SingleAssignmentDisposable()
     let group = CompositeDisposable()
 
+    // Counts elements of inner sequences, the buffer depth is the number of inner sequences waiting to be subscribed.
+    let metrics = Metrics.register("mergeLimited")
+
     init(maxConcurrent: Int, observer: Observer, cancel: Cancelable) {
         self.maxConcurrent = maxConcurrent
         super.init(observer: observer, cancel: cancel)
@@ -256,6 +261,7 @@ private class MergeLimitedSink<SourceElement, SourceSequence: ObservableConverti
             }
 
             if let next = queue.dequeue() {
+                metrics?.buffered(queue.count)
                 return (next, false)
             }
 
@@ -312,6 +318,8 @@ private class MergeLimitedSink<SourceElement, SourceSequence: ObservableConverti
 
                 self.queue.enqueue(value)
 
+                defer { self.metrics?.buffered(self.queue.count) }
+
                 if self.activeCount < self.maxConcurrent, let next = self.queue.dequeue() {
                     self.activeCount += 1
                     return next
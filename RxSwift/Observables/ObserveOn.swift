@@ -6,6 +6,25 @@
 //  Copyright © 2015 Krunoslav Zaher. All rights reserved.
 //
 
+import Dispatch
+
+/// Maximum number of events an `observe(on:)` sink delivers per scheduler hop.
+private let observeOnDrainBatchSize = 128
+
+/// Strategy used by `observe(on:bufferSize:overflow:)` when an element arrives and the buffer is full.
+public enum BufferOverflowStrategy {
+    /// Drops the oldest buffered element to make room for the new one.
+    case dropOldest
+    /// Drops the new element.
+    case dropNewest
+    /// Terminates the sequence with `RxError.bufferOverflow` once the buffered elements are delivered.
+    case error
+    /// Blocks the producing thread until there is room in the buffer.
+    ///
+    /// The producer must not emit on the thread that the scheduler uses to deliver elements, otherwise it will deadlock.
+    case block
+}
+
 public extension ObservableType {
     /**
      Wraps the source sequence in order to run its observer callbacks on the specified scheduler.
@@ -21,14 +40,46 @@ public extension ObservableType {
     func observe(on scheduler: ImmediateSchedulerType)
         -> Observable<Element>
     {
-        guard let serialScheduler = scheduler as? SerialDispatchQueueScheduler else {
-            return ObserveOn(source: asObservable(), scheduler: scheduler)
+        if let serialScheduler = scheduler as? SerialDispatchQueueScheduler {
+            return ObserveOnSerialDispatchQueue(
+                source: asObservable(),
+                scheduler: serialScheduler
+            )
+        }
+
+        #if swift(>=5.7)
+        if #available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *), let executorScheduler = scheduler as? ExecutorScheduler {
+            return ObserveOnSerialDispatchQueue(
+                source: asObservable(),
+                scheduler: executorScheduler
+            )
         }
+        #endif
+
+        return ObserveOn(source: asObservable(), scheduler: scheduler)
+    }
+
+    /**
+     Wraps the source sequence in order to run its observer callbacks on the specified scheduler,
+     buffering at most `bufferSize` elements that haven't been delivered yet.
+
+     Buffered elements are delivered in batches, so a fast producer costs one scheduler hop per batch
+     instead of one per element. Termination events are never dropped and are delivered after all buffered elements.
+
+     This only invokes observer callbacks on a `scheduler`. In case the subscription and/or unsubscription
+     actions have side-effects that require to be run on a scheduler, use `subscribeOn`.
+
+     - seealso: [observeOn operator on reactivex.io](http://reactivex.io/documentation/operators/observeon.html)
 
-        return ObserveOnSerialDispatchQueue(
-            source: asObservable(),
-            scheduler: serialScheduler
-        )
+     - parameter scheduler: Scheduler to notify observers on.
+     - parameter bufferSize: Maximum number of elements waiting to be delivered.
+     - parameter overflow: Strategy used when an element arrives and the buffer is full.
+     - returns: The source sequence whose observations happen on the specified scheduler.
+     */
+    func observe(on scheduler: ImmediateSchedulerType, bufferSize: Int, overflow: BufferOverflowStrategy)
+        -> Observable<Element>
+    {
+        ObserveOnBuffered(source: asObservable(), scheduler: scheduler, bufferSize: bufferSize, overflow: overflow)
     }
 
     /**
@@ -95,6 +146,11 @@ private final class ObserveOnSink<Observer: ObserverType>: ObserverBase<Observer
     var state = ObserveOnState.stopped
     var queue = Queue<Event<Element>>(capacity: 10)
 
+    // events dequeued for the current scheduler hop, only touched by `run`
+    private var drained = ContiguousArray<Event<Element>>()
+
+    private let metrics = Metrics.register("observeOn")
+
     let scheduleDisposable = SerialDisposable()
     let cancel: Cancelable
 
@@ -107,6 +163,10 @@ private final class ObserveOnSink<Observer: ObserverType>: ObserverBase<Observer
     override func onCore(_ event: Event<Element>) {
         let shouldStart = lock.performLocked { () -> Bool in
             self.queue.enqueue(event)
+            if case .next = event {
+                self.metrics?.received()
+            }
+            self.metrics?.buffered(self.queue.count)
 
             switch self.state {
             case .stopped:
@@ -123,21 +183,19 @@ private final class ObserveOnSink<Observer: ObserverType>: ObserverBase<Observer
     }
 
     func run(_: (), _ recurse: (()) -> Void) {
-        let (nextEvent, observer) = lock.performLocked { () -> (Event<Element>?, Observer) in
-            if !self.queue.isEmpty {
-                return (self.queue.dequeue(), self.observer)
-            } else {
+        let hasEvents = lock.performLocked { () -> Bool in
+            while self.drained.count < observeOnDrainBatchSize, let event = self.queue.dequeue() {
+                self.drained.append(event)
+            }
+            self.metrics?.buffered(self.queue.count)
+            if self.drained.isEmpty {
                 self.state = .stopped
-                return (nil, self.observer)
+                return false
             }
+            return true
         }
 
-        if let nextEvent, !self.cancel.isDisposed {
-            observer.on(nextEvent)
-            if nextEvent.isStopEvent {
-                dispose()
-            }
-        } else {
+        guard hasEvents, deliverDrained() else {
             return
         }
 
@@ -148,6 +206,33 @@ private final class ObserveOnSink<Observer: ObserverType>: ObserverBase<Observer
         }
     }
 
+    /// - returns: `false` if the sink got disposed while delivering events.
+    private func deliverDrained() -> Bool {
+        var elementCount = 0
+        defer {
+            metrics?.sent(elementCount)
+            drained.removeAll(keepingCapacity: true)
+        }
+
+        for event in drained {
+            if cancel.isDisposed {
+                return false
+            }
+            if event.isStopEvent {
+                // Counts are final by the time the observer sees the sequence terminate.
+                metrics?.sent(elementCount)
+                elementCount = 0
+                observer.on(event)
+                dispose()
+                return false
+            }
+            observer.on(event)
+            elementCount += 1
+        }
+
+        return true
+    }
+
     func shouldContinue_synchronized() -> Bool {
         lock.performLocked {
             let isEmpty = self.queue.isEmpty
@@ -178,35 +263,116 @@ public extension Resources {
 }
 #endif
 
+/// Sink for schedulers that perform actions serially, so it doesn't need to guard against concurrent drains.
 private final class ObserveOnSerialDispatchQueueSink<Observer: ObserverType>: ObserverBase<Observer.Element> {
-    let scheduler: SerialDispatchQueueScheduler
+    let scheduler: ImmediateSchedulerType
     let observer: Observer
 
     let cancel: Cancelable
 
-    var cachedScheduleLambda: (((sink: ObserveOnSerialDispatchQueueSink<Observer>, event: Event<Element>)) -> Disposable)!
+    private let lock = SpinLock()
+
+    // state
+    private var state = ObserveOnState.stopped
+    private var queue = Queue<Event<Element>>(capacity: 10)
+
+    // events dequeued for the current scheduler hop, only touched on `scheduler`
+    private var drained = ContiguousArray<Event<Element>>()
 
-    init(scheduler: SerialDispatchQueueScheduler, observer: Observer, cancel: Cancelable) {
+    private let metrics = Metrics.register("observeOn")
+
+    var cachedScheduleLambda: ((ObserveOnSerialDispatchQueueSink<Observer>) -> Disposable)!
+
+    init(scheduler: ImmediateSchedulerType, observer: Observer, cancel: Cancelable) {
         self.scheduler = scheduler
         self.observer = observer
         self.cancel = cancel
         super.init()
 
-        cachedScheduleLambda = { pair in
-            guard !cancel.isDisposed else { return Disposables.create() }
+        cachedScheduleLambda = { sink in
+            sink.drain()
+            return Disposables.create()
+        }
+    }
+
+    override func onCore(_ event: Event<Element>) {
+        let shouldStart = lock.performLocked { () -> Bool in
+            self.queue.enqueue(event)
+            if case .next = event {
+                self.metrics?.received()
+            }
+            self.metrics?.buffered(self.queue.count)
+
+            switch self.state {
+            case .stopped:
+                self.state = .running
+                return true
+            case .running:
+                return false
+            }
+        }
+
+        if shouldStart {
+            _ = scheduler.schedule(self, action: cachedScheduleLambda!)
+        }
+    }
 
-            pair.sink.observer.on(pair.event)
+    private func drain() {
+        guard !cancel.isDisposed else { return }
 
-            if pair.event.isStopEvent {
-                pair.sink.dispose()
+        let hasEvents = lock.performLocked { () -> Bool in
+            while self.drained.count < observeOnDrainBatchSize, let event = self.queue.dequeue() {
+                self.drained.append(event)
             }
+            self.metrics?.buffered(self.queue.count)
+            if self.drained.isEmpty {
+                self.state = .stopped
+                return false
+            }
+            return true
+        }
 
-            return Disposables.create()
+        guard hasEvents, deliverDrained() else {
+            return
+        }
+
+        let shouldContinue = lock.performLocked { () -> Bool in
+            let isEmpty = self.queue.isEmpty
+            if isEmpty { self.state = .stopped }
+            return !isEmpty
+        }
+
+        // The rest is delivered on a later hop so other work on the queue isn't starved.
+        if shouldContinue {
+            _ = scheduler.schedule(self, action: cachedScheduleLambda!)
         }
     }
 
-    override func onCore(_ event: Event<Element>) {
-        _ = scheduler.schedule((self, event), action: cachedScheduleLambda!)
+    /// - returns: `false` if the sink got disposed while delivering events.
+    private func deliverDrained() -> Bool {
+        var elementCount = 0
+        defer {
+            metrics?.sent(elementCount)
+            drained.removeAll(keepingCapacity: true)
+        }
+
+        for event in drained {
+            if cancel.isDisposed {
+                return false
+            }
+            if event.isStopEvent {
+                // Counts are final by the time the observer sees the sequence terminate.
+                metrics?.sent(elementCount)
+                elementCount = 0
+                observer.on(event)
+                dispose()
+                return false
+            }
+            observer.on(event)
+            elementCount += 1
+        }
+
+        return true
     }
 
     override func dispose() {
@@ -217,10 +383,11 @@ private final class ObserveOnSerialDispatchQueueSink<Observer: ObserverType>: Ob
 }
 
 private final class ObserveOnSerialDispatchQueue<Element>: Producer<Element> {
-    let scheduler: SerialDispatchQueueScheduler
+    let scheduler: ImmediateSchedulerType
     let source: Observable<Element>
 
-    init(source: Observable<Element>, scheduler: SerialDispatchQueueScheduler) {
+    /// - parameter scheduler: Scheduler that performs actions serially, in the order they were scheduled.
+    init(source: Observable<Element>, scheduler: ImmediateSchedulerType) {
         self.scheduler = scheduler
         self.source = source
 
@@ -243,3 +410,229 @@ private final class ObserveOnSerialDispatchQueue<Element>: Producer<Element> {
     }
     #endif
 }
+
+private final class ObserveOnBuffered<Element>: Producer<Element> {
+    let scheduler: ImmediateSchedulerType
+    let source: Observable<Element>
+    let bufferSize: Int
+    let overflow: BufferOverflowStrategy
+
+    init(source: Observable<Element>, scheduler: ImmediateSchedulerType, bufferSize: Int, overflow: BufferOverflowStrategy) {
+        guard bufferSize > 0 else {
+            rxFatalError("bufferSize must be positive")
+        }
+
+        self.scheduler = scheduler
+        self.source = source
+        self.bufferSize = bufferSize
+        self.overflow = overflow
+
+        #if TRACE_RESOURCES
+        _ = Resources.incrementTotal()
+        #endif
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        let sink = ObserveOnBufferedSink(parent: self, observer: observer, cancel: cancel)
+        sink.subscription.setDisposable(source.subscribe(sink))
+        return (sink: sink, subscription: sink.subscription)
+    }
+
+    #if TRACE_RESOURCES
+    deinit {
+        _ = Resources.decrementTotal()
+    }
+    #endif
+}
+
+private final class ObserveOnBufferedSink<Observer: ObserverType>: ObserverBase<Observer.Element> {
+    typealias Element = Observer.Element
+    typealias Parent = ObserveOnBuffered<Element>
+
+    private let scheduler: ImmediateSchedulerType
+    private let overflow: BufferOverflowStrategy
+    private let observer: Observer
+    private let cancel: Cancelable
+
+    private let lock = SpinLock()
+    private let scheduleDisposable = SerialDisposable()
+    private let producerUnblocked = DispatchSemaphore(value: 0)
+    private let metrics = Metrics.register("observeOn")
+
+    let subscription = SingleAssignmentDisposable()
+
+    // state
+    private var state = ObserveOnState.stopped
+    private var buffer: RingBuffer<Element>
+    private var terminalEvent: Event<Element>?
+    private var isProducerBlocked = false
+
+    // events dequeued for the current scheduler hop, only touched by `run`
+    private var drained = ContiguousArray<Event<Element>>()
+
+    init(parent: Parent, observer: Observer, cancel: Cancelable) {
+        scheduler = parent.scheduler
+        overflow = parent.overflow
+        buffer = RingBuffer(capacity: parent.bufferSize)
+        self.observer = observer
+        self.cancel = cancel
+    }
+
+    override func onCore(_ event: Event<Element>) {
+        let shouldStart: Bool
+        switch event {
+        case let .next(element):
+            shouldStart = enqueue(element)
+        case .error, .completed:
+            shouldStart = lock.performLocked { () -> Bool in
+                if self.terminalEvent != nil {
+                    return false
+                }
+                self.terminalEvent = event
+                return self.synchronized_start()
+            }
+        }
+
+        if shouldStart {
+            scheduleDisposable.disposable = scheduler.scheduleRecursive((), action: run)
+        }
+    }
+
+    /// - returns: `true` if the drain has to be started.
+    private func enqueue(_ element: Element) -> Bool {
+        while true {
+            var isOverflowed = false
+
+            // `nil` means the producer has to wait for room in the buffer.
+            let shouldStart = lock.performLocked { () -> Bool? in
+                if self.terminalEvent != nil || self.cancel.isDisposed {
+                    return false
+                }
+
+                if self.buffer.enqueue(element) {
+                    self.metrics?.received()
+                    self.metrics?.buffered(self.buffer.count)
+                    return self.synchronized_start()
+                }
+
+                switch self.overflow {
+                case .dropOldest:
+                    _ = self.buffer.dequeue()
+                    self.buffer.enqueue(element)
+                    self.metrics?.received()
+                    return false
+                case .dropNewest:
+                    self.metrics?.received()
+                    return false
+                case .error:
+                    self.terminalEvent = .error(RxError.bufferOverflow)
+                    isOverflowed = true
+                    return self.synchronized_start()
+                case .block:
+                    self.isProducerBlocked = true
+                    return nil
+                }
+            }
+
+            // The sequence already failed, the source doesn't have to keep producing until the error is delivered.
+            if isOverflowed {
+                subscription.dispose()
+            }
+
+            if let shouldStart {
+                return shouldStart
+            }
+
+            producerUnblocked.wait()
+        }
+    }
+
+    private func synchronized_start() -> Bool {
+        switch state {
+        case .stopped:
+            state = .running
+            return true
+        case .running:
+            return false
+        }
+    }
+
+    private func synchronized_unblockProducer() {
+        if isProducerBlocked {
+            isProducerBlocked = false
+            producerUnblocked.signal()
+        }
+    }
+
+    func run(_: (), _ recurse: (()) -> Void) {
+        let hasEvents = lock.performLocked { () -> Bool in
+            while self.drained.count < observeOnDrainBatchSize, let element = self.buffer.dequeue() {
+                self.drained.append(.next(element))
+            }
+            self.metrics?.buffered(self.buffer.count)
+            if self.buffer.isEmpty, self.drained.count < observeOnDrainBatchSize, let terminalEvent = self.terminalEvent {
+                self.drained.append(terminalEvent)
+            }
+            self.synchronized_unblockProducer()
+
+            if self.drained.isEmpty {
+                self.state = .stopped
+                return false
+            }
+            return true
+        }
+
+        guard hasEvents, deliverDrained() else {
+            return
+        }
+
+        let shouldContinue = lock.performLocked { () -> Bool in
+            let isEmpty = self.buffer.isEmpty && self.terminalEvent == nil
+            if isEmpty { self.state = .stopped }
+            return !isEmpty
+        }
+
+        if shouldContinue {
+            recurse(())
+        }
+    }
+
+    /// - returns: `false` if the sink got disposed while delivering events.
+    private func deliverDrained() -> Bool {
+        var elementCount = 0
+        defer {
+            metrics?.sent(elementCount)
+            drained.removeAll(keepingCapacity: true)
+        }
+
+        for event in drained {
+            if cancel.isDisposed {
+                return false
+            }
+            if event.isStopEvent {
+                // Counts are final by the time the observer sees the sequence terminate.
+                metrics?.sent(elementCount)
+                elementCount = 0
+                observer.on(event)
+                dispose()
+                return false
+            }
+            observer.on(event)
+            elementCount += 1
+        }
+
+        return true
+    }
+
+    override func dispose() {
+        super.dispose()
+
+        cancel.dispose()
+        scheduleDisposable.dispose()
+
+        lock.performLocked {
+            self.buffer.removeAll()
+            self.synchronized_unblockProducer()
+        }
+    }
+}
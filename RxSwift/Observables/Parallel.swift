@@ -0,0 +1,394 @@
+//
+//  Parallel.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+
+public extension ObservableType {
+    /**
+     Splits the observable sequence into `rails` that process elements concurrently on `scheduler`.
+
+     Source elements are assigned to rails round-robin. Every rail processes its elements one at a time,
+     and different rails run in parallel. Describe the per element work with `map`, `compactMap` and `filter`
+     on the result, and merge the rails back into an observable sequence with `sequential(ordered:)`.
+
+     Per element closures are called concurrently from different rails and must be thread safe.
+
+     Rails don't apply backpressure to the source. Elements wait in the queue of their rail until the rail gets to
+     them, so a source that's faster than the rails makes those queues grow without bound. Throttle or buffer the
+     source when it can outpace the per element work.
+
+     - parameter scheduler: Scheduler to run rails on. A concurrent scheduler like `WorkStealingScheduler` is required for rails to actually run in parallel.
+     - parameter rails: Number of rails, defaults to the number of active processors.
+     - returns: The parallel representation of the source sequence.
+     */
+    func parallel(on scheduler: ImmediateSchedulerType, rails: Int = ProcessInfo.processInfo.activeProcessorCount) -> ParallelObservable<Element> {
+        guard rails > 0 else {
+            rxFatalError("rails must be positive")
+        }
+
+        return ParallelSource(source: asObservable(), scheduler: scheduler, rails: rails) { $0 }
+    }
+}
+
+/// Observable sequence split into rails that process elements concurrently.
+///
+/// Created with `parallel(on:rails:)` and merged back with `sequential(ordered:)`.
+public class ParallelObservable<Element> {
+    /// Number of rails.
+    public let rails: Int
+
+    init(rails: Int) {
+        self.rails = rails
+    }
+
+    /**
+     Projects each element on its rail.
+
+     - parameter transform: A transform function to apply to each source element.
+     - returns: Parallel sequence whose elements are the result of invoking the transform function on each element of source.
+     */
+    public func map<Result>(_ transform: @escaping (Element) throws -> Result) -> ParallelObservable<Result> {
+        composed { element -> Result? in
+            try transform(element)
+        }
+    }
+
+    /**
+     Projects each element on its rail and drops `nil` results.
+
+     - parameter transform: A transform function to apply to each source element and which returns an element or nil.
+     - returns: Parallel sequence whose elements are the non-nil results of invoking the transform function on each element of source.
+     */
+    public func compactMap<Result>(_ transform: @escaping (Element) throws -> Result?) -> ParallelObservable<Result> {
+        composed(transform)
+    }
+
+    /**
+     Filters elements on their rails based on a predicate.
+
+     - parameter predicate: A function to test each source element for a condition.
+     - returns: Parallel sequence that contains elements from the input sequence that satisfy the condition.
+     */
+    public func filter(_ predicate: @escaping (Element) throws -> Bool) -> ParallelObservable<Element> {
+        composed { element in
+            try predicate(element) ? element : nil
+        }
+    }
+
+    /**
+     Merges the rails back into an observable sequence.
+
+     With `ordered: true`, a rail that falls behind holds back all results that follow its oldest element, so the
+     reordering buffer can grow up to the number of elements the other rails process in the meantime. With a slow
+     rail and a long source that's most of the stream.
+
+     Errors are delivered like serial operators deliver them: results of all elements that precede the failed
+     element in source order are delivered first, regardless of the order in which rails finish.
+
+     - parameter ordered: When `true`, elements are delivered in source order, which requires buffering results
+     of rails that got ahead. When `false`, elements are delivered as soon as any rail produces them.
+     - returns: An observable sequence containing results of all rails.
+     */
+    public func sequential(ordered: Bool = true) -> Observable<Element> {
+        ParallelSequential(parallel: self, ordered: ordered)
+    }
+
+    func composed<Result>(_ stage: @escaping ElementStage<Element, Result>) -> ParallelObservable<Result> {
+        rxAbstractMethod()
+    }
+
+    func subscribe<Observer: ParallelObserverType>(_ observer: Observer) -> Disposable where Observer.Element == Element {
+        rxAbstractMethod()
+    }
+}
+
+/// Receives results of rails.
+///
+/// `on(sequence:result:)` is called concurrently from different rails.
+protocol ParallelObserverType: AnyObject {
+    associatedtype Element
+
+    /// Result of the source element with index `sequence`, `nil` if the rail dropped it.
+    ///
+    /// A failure terminates the sequence at index `sequence`. Source errors are reported at the index following
+    /// the last source element.
+    func on(sequence: Int, result: Result<Element?, Error>)
+
+    /// Source completed after producing `count` elements.
+    func onCompleted(count: Int)
+}
+
+private final class ParallelSource<SourceElement, Element>: ParallelObservable<Element> {
+    private let source: Observable<SourceElement>
+    private let scheduler: ImmediateSchedulerType
+    private let stage: ElementStage<SourceElement, Element>
+
+    init(source: Observable<SourceElement>, scheduler: ImmediateSchedulerType, rails: Int, stage: @escaping ElementStage<SourceElement, Element>) {
+        self.source = source
+        self.scheduler = scheduler
+        self.stage = stage
+        super.init(rails: rails)
+    }
+
+    override func composed<Result>(_ nextStage: @escaping ElementStage<Element, Result>) -> ParallelObservable<Result> {
+        let stage = stage
+        return ParallelSource<SourceElement, Result>(source: source, scheduler: scheduler, rails: rails) { element in
+            guard let intermediate = try stage(element) else {
+                return nil
+            }
+            return try nextStage(intermediate)
+        }
+    }
+
+    override func subscribe<Observer: ParallelObserverType>(_ observer: Observer) -> Disposable where Observer.Element == Element {
+        let sink = ParallelSourceSink(scheduler: scheduler, rails: rails, stage: stage, observer: observer)
+        sink.subscription.setDisposable(source.subscribe(sink))
+        return sink
+    }
+}
+
+private final class ParallelRail<Element> {
+    let lock = SpinLock()
+    let scheduled = SerialDisposable()
+
+    // state
+    var queue = Queue<(sequence: Int, element: Element)>(capacity: 1)
+    var isRunning = false
+}
+
+private final class ParallelSourceSink<Observer: ParallelObserverType, SourceElement>: ObserverType, Disposable {
+    typealias Element = SourceElement
+
+    private let scheduler: ImmediateSchedulerType
+    private let stage: ElementStage<SourceElement, Observer.Element>
+    private let observer: Observer
+    private let rails: [ParallelRail<SourceElement>]
+    private let disposed = AtomicInt(0)
+
+    let subscription = SingleAssignmentDisposable()
+
+    // source events are serialized
+    private var sequence = 0
+
+    init(scheduler: ImmediateSchedulerType, rails: Int, stage: @escaping ElementStage<SourceElement, Observer.Element>, observer: Observer) {
+        self.scheduler = scheduler
+        self.stage = stage
+        self.observer = observer
+        self.rails = (0 ..< rails).map { _ in ParallelRail() }
+    }
+
+    func on(_ event: Event<SourceElement>) {
+        if isFlagSet(disposed, 1) {
+            return
+        }
+
+        switch event {
+        case let .next(element):
+            let rail = rails[sequence % rails.count]
+            let entry = (sequence: sequence, element: element)
+            sequence += 1
+
+            let shouldSchedule = rail.lock.performLocked { () -> Bool in
+                rail.queue.enqueue(entry)
+                defer { rail.isRunning = true }
+                return !rail.isRunning
+            }
+
+            if shouldSchedule {
+                rail.scheduled.disposable = scheduler.schedule(rail) { rail in
+                    self.drain(rail)
+                    return Disposables.create()
+                }
+            }
+        case let .error(error):
+            observer.on(sequence: sequence, result: .failure(error))
+        case .completed:
+            observer.onCompleted(count: sequence)
+        }
+    }
+
+    private func drain(_ rail: ParallelRail<SourceElement>) {
+        while !isFlagSet(disposed, 1) {
+            let next = rail.lock.performLocked { () -> (sequence: Int, element: SourceElement)? in
+                if let entry = rail.queue.dequeue() {
+                    return entry
+                }
+                rail.isRunning = false
+                return nil
+            }
+
+            guard let next else {
+                return
+            }
+
+            do {
+                let result = try stage(next.element)
+                observer.on(sequence: next.sequence, result: .success(result))
+            } catch {
+                // Other rails keep running, elements that precede this one still have to be delivered.
+                // Everything after it is dropped.
+                subscription.dispose()
+                rail.lock.performLocked {
+                    rail.queue = Queue(capacity: 1)
+                    rail.isRunning = false
+                }
+                observer.on(sequence: next.sequence, result: .failure(error))
+                return
+            }
+        }
+    }
+
+    func dispose() {
+        if fetchOr(disposed, 1) != 0 {
+            return
+        }
+
+        subscription.dispose()
+        for rail in rails {
+            rail.scheduled.dispose()
+        }
+    }
+}
+
+private final class ParallelSequential<Element>: Producer<Element> {
+    private let parallel: ParallelObservable<Element>
+    private let ordered: Bool
+
+    init(parallel: ParallelObservable<Element>, ordered: Bool) {
+        self.parallel = parallel
+        self.ordered = ordered
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        let sink = ParallelSequentialSink(ordered: ordered, observer: observer, cancel: cancel)
+        let subscription = parallel.subscribe(sink)
+        return (sink: sink, subscription: subscription)
+    }
+}
+
+private final class ParallelSequentialSink<Observer: ObserverType>: Sink<Observer>, ParallelObserverType {
+    typealias Element = Observer.Element
+
+    private let ordered: Bool
+    private let lock = SpinLock()
+
+    // state
+    private var isDraining = false
+    // Results that got ahead of `nextSequence`. Unordered elements are delivered right away and only
+    // leave a `nil` marker, so an error is still delivered after all the elements that precede it.
+    private var reordering = [Int: Result<Element?, Error>]()
+    private var nextSequence = 0
+    private var ready = ContiguousArray<Element>()
+    private var received = 0
+    private var count: Int?
+    private var error: Error?
+
+    // only touched by the draining thread
+    private var delivering = ContiguousArray<Element>()
+
+    init(ordered: Bool, observer: Observer, cancel: Cancelable) {
+        self.ordered = ordered
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func on(sequence: Int, result: Result<Element?, Error>) {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            if self.error != nil {
+                return false
+            }
+
+            self.received += 1
+            if !self.ordered, case let .success(element?) = result {
+                self.ready.append(element)
+                self.reordering[sequence] = .success(nil)
+            } else {
+                self.reordering[sequence] = result
+            }
+
+            while self.error == nil, let result = self.reordering.removeValue(forKey: self.nextSequence) {
+                switch result {
+                case let .success(element):
+                    self.nextSequence += 1
+                    if let element {
+                        self.ready.append(element)
+                    }
+                case let .failure(error):
+                    self.error = error
+                    self.reordering.removeAll()
+                }
+            }
+
+            return self.synchronized_startDraining()
+        }
+
+        if shouldDrain {
+            drain()
+        }
+    }
+
+    func onCompleted(count: Int) {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            self.count = count
+            return self.synchronized_startDraining()
+        }
+
+        if shouldDrain {
+            drain()
+        }
+    }
+
+    private func synchronized_startDraining() -> Bool {
+        if isDraining {
+            return false
+        }
+        isDraining = true
+        return true
+    }
+
+    private enum DrainAction {
+        case stop
+        case deliver
+        case terminate(Event<Element>)
+    }
+
+    private func drain() {
+        while !isDisposed {
+            let action = lock.performLocked { () -> DrainAction in
+                swap(&self.ready, &self.delivering)
+
+                if !self.delivering.isEmpty {
+                    return .deliver
+                }
+
+                // Only after everything that precedes the error in source order.
+                if let error = self.error {
+                    return .terminate(.error(error))
+                }
+
+                if let count = self.count, self.received == count {
+                    return .terminate(.completed)
+                }
+
+                self.isDraining = false
+                return .stop
+            }
+
+            switch action {
+            case .stop:
+                return
+            case .deliver:
+                delivering.withUnsafeBufferPointer { forwardOn(batch: $0) }
+                delivering.removeAll(keepingCapacity: true)
+            case let .terminate(event):
+                forwardOn(event)
+                dispose()
+                return
+            }
+        }
+    }
+}
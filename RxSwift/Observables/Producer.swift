@@ -35,30 +35,28 @@ class Producer<Element>: Observable<Element> {
     }
 }
 
-private final class SinkDisposer: Cancelable {
-    private enum DisposeState: Int32 {
-        case disposed = 1
-        case sinkAndSubscriptionSet = 2
-    }
-
-    private let state = AtomicInt(0)
+/// Disposes the sink and the subscription created by `Producer.run`.
+///
+/// The disposer is the atomic state itself, and sinks created with it as `cancel` keep their own flags in it
+/// too (see `SinkState`), so a subscription costs one atomic object instead of two per operator.
+final class SinkDisposer: AtomicInt, Cancelable {
     private var sink: Disposable?
     private var subscription: Disposable?
 
     var isDisposed: Bool {
-        isFlagSet(state, DisposeState.disposed.rawValue)
+        isFlagSet(self, SinkState.subscriptionDisposed)
     }
 
     func setSinkAndSubscription(sink: Disposable, subscription: Disposable) {
         self.sink = sink
         self.subscription = subscription
 
-        let previousState = fetchOr(state, DisposeState.sinkAndSubscriptionSet.rawValue)
-        if (previousState & DisposeState.sinkAndSubscriptionSet.rawValue) != 0 {
+        let previousState = fetchOr(self, SinkState.sinkAndSubscriptionSet)
+        if (previousState & SinkState.sinkAndSubscriptionSet) != 0 {
             rxFatalError("Sink and subscription were already set")
         }
 
-        if (previousState & DisposeState.disposed.rawValue) != 0 {
+        if (previousState & SinkState.subscriptionDisposed) != 0 {
             sink.dispose()
             subscription.dispose()
             self.sink = nil
@@ -67,13 +65,13 @@ private final class SinkDisposer: Cancelable {
     }
 
     func dispose() {
-        let previousState = fetchOr(state, DisposeState.disposed.rawValue)
+        let previousState = fetchOr(self, SinkState.subscriptionDisposed)
 
-        if (previousState & DisposeState.disposed.rawValue) != 0 {
+        if (previousState & SinkState.subscriptionDisposed) != 0 {
             return
         }
 
-        if (previousState & DisposeState.sinkAndSubscriptionSet.rawValue) != 0 {
+        if (previousState & SinkState.sinkAndSubscriptionSet) != 0 {
             guard let sink else {
                 rxFatalError("Sink not set")
             }
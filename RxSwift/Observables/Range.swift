@@ -59,7 +59,7 @@ private final class RangeSink<Observer: ObserverType>: Sink<Observer> where Obse
     }
 
     func run() -> Disposable {
-        parent.scheduler.scheduleRecursive(0 as Observer.Element) { i, recurse in
+        parent.scheduler.scheduleRecursiveLoop(0 as Observer.Element) { i, recurse in
             if i < self.parent.count {
                 self.forwardOn(.next(self.parent.start + i))
                 recurse(i + 1)
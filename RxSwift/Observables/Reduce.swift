@@ -43,7 +43,7 @@ public extension ObservableType {
     }
 }
 
-private final class ReduceSink<SourceType, AccumulateType, Observer: ObserverType>: Sink<Observer>, ObserverType {
+private final class ReduceSink<SourceType, AccumulateType, Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType {
     typealias ResultType = Observer.Element
     typealias Parent = Reduce<SourceType, AccumulateType, ResultType>
 
@@ -81,6 +81,17 @@ private final class ReduceSink<SourceType, AccumulateType, Observer: ObserverTyp
             }
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        do {
+            for value in elements.assumingElementType(SourceType.self) {
+                accumulation = try parent.accumulator(accumulation, value)
+            }
+        } catch let e {
+            self.forwardOn(.error(e))
+            self.dispose()
+        }
+    }
 }
 
 private final class Reduce<SourceType, AccumulateType, ResultType>: Producer<ResultType> {
@@ -49,7 +49,7 @@ private final class RepeatElementSink<Observer: ObserverType>: Sink<Observer> {
     }
 
     func run() -> Disposable {
-        parent.scheduler.scheduleRecursive(parent.element) { e, recurse in
+        parent.scheduler.scheduleRecursiveLoop(parent.element) { e, recurse in
             self.forwardOn(.next(e))
             recurse(e)
         }
@@ -21,7 +21,9 @@ public extension ObservableType {
     func scan<A>(into seed: A, accumulator: @escaping (inout A, Element) throws -> Void)
         -> Observable<A>
     {
-        Scan(source: asObservable(), seed: seed, accumulator: accumulator)
+        let source = asObservable()
+        return source.fused(with: { Scan<Element, A>.makeStage(seed: seed, accumulator: accumulator) })
+            ?? Scan(source: source, seed: seed, accumulator: accumulator)
     }
 
     /**
@@ -38,14 +40,14 @@ public extension ObservableType {
     func scan<A>(_ seed: A, accumulator: @escaping (A, Element) throws -> A)
         -> Observable<A>
     {
-        Scan(source: asObservable(), seed: seed) { acc, element in
+        scan(into: seed) { acc, element in
             let currentAcc = acc
             acc = try accumulator(currentAcc, element)
         }
     }
 }
 
-private final class ScanSink<Element, Observer: ObserverType>: Sink<Observer>, ObserverType {
+private final class ScanSink<Element, Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType {
     typealias Accumulate = Observer.Element
     typealias Parent = Scan<Element, Accumulate>
 
@@ -76,19 +78,38 @@ private final class ScanSink<Element, Observer: ObserverType>: Sink<Observer>, O
             dispose()
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        let accumulator = parent.accumulator
+        forwardOn(batch: elements.assumingElementType(Element.self)) { element in
+            try accumulator(&self.accumulate, element)
+            return self.accumulate
+        }
+    }
 }
 
-private final class Scan<Element, Accumulate>: Producer<Accumulate> {
+private final class Scan<Element, Accumulate>: FusibleProducer<Element, Accumulate> {
     typealias Accumulator = (inout Accumulate, Element) throws -> Void
 
-    private let source: Observable<Element>
     fileprivate let seed: Accumulate
     fileprivate let accumulator: Accumulator
 
     init(source: Observable<Element>, seed: Accumulate, accumulator: @escaping Accumulator) {
-        self.source = source
         self.seed = seed
         self.accumulator = accumulator
+        super.init(source: source)
+    }
+
+    static func makeStage(seed: Accumulate, accumulator: @escaping Accumulator) -> ElementStage<Element, Accumulate> {
+        var accumulate = seed
+        return { element in
+            try accumulator(&accumulate, element)
+            return accumulate
+        }
+    }
+
+    override func makeStage() -> ElementStage<Element, Accumulate> {
+        Scan.makeStage(seed: seed, accumulator: accumulator)
     }
 
     override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Accumulate {
@@ -35,6 +35,28 @@ public extension ObservableType {
         ObservableSequence(elements: array, scheduler: scheduler)
     }
 
+    /**
+     Converts an array to an observable sequence that delivers its elements in batches.
+
+     Each scheduled step delivers up to `batchSize` consecutive elements. Batch-aware operators (`map`, `filter`,
+     `compactMap`, `scan`, `reduce`, `toArray`, `buffer`) process a whole batch in a tight loop, and any other
+     observer receives the elements as individual `next` events.
+
+     Because a whole batch is processed by each batch-aware operator before it's passed on, an operator may be
+     invoked for elements of the current batch that a downstream observer will never receive after it disposes
+     its subscription.
+
+     - seealso: [from operator on reactivex.io](http://reactivex.io/documentation/operators/from.html)
+
+     - parameter array: Elements to generate.
+     - parameter batchSize: Maximum number of elements delivered by each scheduled step.
+     - parameter scheduler: Scheduler to send elements on.
+     - returns: The observable sequence whose elements are pulled from the given array.
+     */
+    static func from(_ array: [Element], batchSize: Int, scheduler: ImmediateSchedulerType = CurrentThreadScheduler.instance) -> Observable<Element> {
+        ObservableBatchedSequence(elements: ContiguousArray(array), batchSize: batchSize, scheduler: scheduler)
+    }
+
     /**
      Converts a sequence to an observable sequence.
 
@@ -58,7 +80,7 @@ private final class ObservableSequenceSink<Sequence: Swift.Sequence, Observer: O
     }
 
     func run() -> Disposable {
-        parent.scheduler.scheduleRecursive(parent.elements.makeIterator()) { iterator, recurse in
+        parent.scheduler.scheduleRecursiveLoop(parent.elements.makeIterator()) { iterator, recurse in
             var mutableIterator = iterator
             if let next = mutableIterator.next() {
                 self.forwardOn(.next(next))
@@ -86,3 +108,52 @@ private final class ObservableSequence<Sequence: Swift.Sequence>: Producer<Seque
         return (sink: sink, subscription: subscription)
     }
 }
+
+private final class ObservableBatchedSequenceSink<Observer: ObserverType>: Sink<Observer> {
+    typealias Parent = ObservableBatchedSequence<Observer.Element>
+
+    private let parent: Parent
+
+    init(parent: Parent, observer: Observer, cancel: Cancelable) {
+        self.parent = parent
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func run() -> Disposable {
+        parent.scheduler.scheduleRecursiveLoop(0) { start, recurse in
+            let elements = self.parent.elements
+            if start < elements.count {
+                let end = start + Swift.min(self.parent.batchSize, elements.count - start)
+                elements.withUnsafeBufferPointer { buffer in
+                    self.forwardOn(batch: UnsafeBufferPointer(rebasing: buffer[start ..< end]))
+                }
+                recurse(end)
+            } else {
+                self.forwardOn(.completed)
+                self.dispose()
+            }
+        }
+    }
+}
+
+private final class ObservableBatchedSequence<Element>: Producer<Element> {
+    fileprivate let elements: ContiguousArray<Element>
+    fileprivate let batchSize: Int
+    fileprivate let scheduler: ImmediateSchedulerType
+
+    init(elements: ContiguousArray<Element>, batchSize: Int, scheduler: ImmediateSchedulerType) {
+        guard batchSize > 0 else {
+            rxFatalError("batchSize must be positive")
+        }
+
+        self.elements = elements
+        self.batchSize = batchSize
+        self.scheduler = scheduler
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        let sink = ObservableBatchedSequenceSink(parent: self, observer: observer, cancel: cancel)
+        let subscription = sink.run()
+        return (sink: sink, subscription: subscription)
+    }
+}
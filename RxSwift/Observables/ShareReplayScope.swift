@@ -148,7 +148,7 @@ public extension ObservableType {
             switch replay {
             case 0: ShareWhileConnected(source: asObservable())
             case 1: ShareReplay1WhileConnected(source: asObservable())
-            default: multicast(makeSubject: { ReplaySubject.create(bufferSize: replay) }).refCount()
+            default: ShareReplayNWhileConnected(source: asObservable(), replay: replay)
             }
         }
     }
@@ -295,6 +295,158 @@ private final class ShareReplay1WhileConnected<Element>:
     }
 }
 
+private final class ShareReplayNWhileConnectedConnection<Element>:
+    ObserverType,
+    SynchronizedUnsubscribeType
+{
+    typealias Observers = AnyObserver<Element>.s
+    typealias DisposeKey = Observers.KeyType
+
+    typealias Parent = ShareReplayNWhileConnected<Element>
+    private let parent: Parent
+    private let subscription = SingleAssignmentDisposable()
+
+    private let lock: RecursiveLock
+    private var disposed: Bool = false
+    fileprivate var observers = Observers()
+    fileprivate var elements: SegmentedBuffer<Element>
+
+    init(parent: Parent, lock: RecursiveLock) {
+        self.parent = parent
+        self.lock = lock
+        elements = SegmentedBuffer(segmentCapacity: Swift.min(parent.replay, 64))
+
+        #if TRACE_RESOURCES
+        _ = Resources.incrementTotal()
+        #endif
+    }
+
+    final func on(_ event: Event<Element>) {
+        let observers = lock.performLocked { self.synchronized_on(event) }
+        dispatch(observers, event)
+    }
+
+    private final func synchronized_on(_ event: Event<Element>) -> Observers {
+        if disposed {
+            return Observers()
+        }
+
+        switch event {
+        case let .next(element):
+            elements.append(element)
+            while elements.count > parent.replay {
+                elements.removeFirst()
+            }
+            return observers
+        case .error, .completed:
+            let observers = observers
+            synchronized_dispose()
+            return observers
+        }
+    }
+
+    final func connect() {
+        subscription.setDisposable(parent.source.subscribe(self))
+    }
+
+    private final func synchronized_dispose() {
+        disposed = true
+        if parent.connection === self {
+            parent.connection = nil
+        }
+        observers = Observers()
+        elements.removeAll()
+    }
+
+    final func synchronizedUnsubscribe(_ disposeKey: DisposeKey) {
+        if lock.performLocked({ self.synchronized_unsubscribe(disposeKey) }) {
+            subscription.dispose()
+        }
+    }
+
+    @inline(__always)
+    private final func synchronized_unsubscribe(_ disposeKey: DisposeKey) -> Bool {
+        // if already unsubscribed, just return
+        if observers.removeKey(disposeKey) == nil {
+            return false
+        }
+
+        if observers.count == 0 {
+            synchronized_dispose()
+            return true
+        }
+
+        return false
+    }
+
+    #if TRACE_RESOURCES
+    deinit {
+        _ = Resources.decrementTotal()
+    }
+    #endif
+}
+
+// Replays from a snapshot of segmented storage, so late subscribers don't copy the buffer.
+private final class ShareReplayNWhileConnected<Element>:
+    Observable<Element>
+{
+    fileprivate typealias Connection = ShareReplayNWhileConnectedConnection<Element>
+
+    fileprivate let source: Observable<Element>
+    fileprivate let replay: Int
+
+    private let lock = RecursiveLock()
+
+    fileprivate var connection: Connection?
+
+    init(source: Observable<Element>, replay: Int) {
+        self.source = source
+        self.replay = replay
+    }
+
+    override func subscribe<Observer: ObserverType>(_ observer: Observer) -> Disposable where Observer.Element == Element {
+        lock.lock()
+        let connection = synchronized_subscribe(observer)
+        let count = connection.observers.count
+
+        // Live events that arrive while the snapshot is replayed are buffered and delivered after it,
+        // so the replay doesn't hold up the source.
+        let replayObserver = ReplaySubjectSubscriptionObserver(observer: observer)
+        let disposeKey = connection.observers.insert(replayObserver.on)
+        let elements = connection.elements.snapshot()
+        lock.unlock()
+
+        replayObserver.replay { observer in
+            for element in elements {
+                observer.on(.next(element))
+            }
+        }
+
+        if count == 0 {
+            connection.connect()
+        }
+
+        return SubscriptionDisposable(owner: connection, key: disposeKey)
+    }
+
+    @inline(__always)
+    private func synchronized_subscribe<Observer: ObserverType>(_: Observer) -> Connection where Observer.Element == Element {
+        let connection: Connection
+
+        if let existingConnection = self.connection {
+            connection = existingConnection
+        } else {
+            connection = ShareReplayNWhileConnectedConnection<Element>(
+                parent: self,
+                lock: lock
+            )
+            self.connection = connection
+        }
+
+        return connection
+    }
+}
+
 private final class ShareWhileConnectedConnection<Element>:
     ObserverType,
     SynchronizedUnsubscribeType
@@ -6,10 +6,23 @@
 //  Copyright © 2015 Krunoslav Zaher. All rights reserved.
 //
 
+/// Flags of the atomic state shared by a sink and the `SinkDisposer` it was created with.
+enum SinkState {
+    /// `SinkDisposer` was disposed.
+    static let subscriptionDisposed: Int32 = 1
+    /// `SinkDisposer` received the sink and the subscription.
+    static let sinkAndSubscriptionSet: Int32 = 2
+    /// Sink was disposed or marked as disposed.
+    static let sinkDisposed: Int32 = 4
+    /// Sink received a terminal event from its source.
+    static let sinkTerminated: Int32 = 8
+}
+
 class Sink<Observer: ObserverType>: Disposable {
     fileprivate let observer: Observer
     fileprivate let cancel: Cancelable
-    private let disposed = AtomicInt(0)
+    /// Sinks created by a `Producer` share the state of their `SinkDisposer`, others own it.
+    private let state: AtomicInt
 
     #if DEBUG
     private let synchronizationTracker = SynchronizationTracker()
@@ -21,6 +34,7 @@ class Sink<Observer: ObserverType>: Disposable {
         #endif
         self.observer = observer
         self.cancel = cancel
+        state = (cancel as? SinkDisposer) ?? AtomicInt(0)
     }
 
     final func forwardOn(_ event: Event<Observer.Element>) {
@@ -28,18 +42,106 @@ class Sink<Observer: ObserverType>: Disposable {
         synchronizationTracker.register(synchronizationErrorMessage: .default)
         defer { self.synchronizationTracker.unregister() }
         #endif
-        if isFlagSet(disposed, 1) {
+        if isFlagSet(state, disposedMask) {
             return
         }
         observer.on(event)
     }
 
+    /// Forwards `elements` as a single batch if the observer accepts batches, or as individual `next` events otherwise.
+    final func forwardOn(batch elements: UnsafeBufferPointer<Observer.Element>) {
+        #if DEBUG
+        synchronizationTracker.register(synchronizationErrorMessage: .default)
+        defer { self.synchronizationTracker.unregister() }
+        #endif
+        if isFlagSet(state, disposedMask) || elements.isEmpty {
+            return
+        }
+        if let batchObserver = observer as? BatchObserverType {
+            batchObserver.on(batch: elements)
+            return
+        }
+        for element in elements {
+            if isFlagSet(state, disposedMask) {
+                return
+            }
+            observer.on(.next(element))
+        }
+    }
+
+    /**
+     Runs `stage` over a batch of source elements and forwards the results.
+
+     If the observer accepts batches, the whole batch is processed in a tight loop and the results are forwarded
+     as one batch. Otherwise each element is processed and forwarded on its own, so the stage isn't invoked for
+     elements that arrive after the observer disposed the subscription.
+
+     If `stage` throws, results produced so far are forwarded, followed by the error, and the sink is disposed.
+     */
+    final func forwardOn<SourceElement>(batch elements: UnsafeBufferPointer<SourceElement>, stage: (SourceElement) throws -> Observer.Element?) {
+        guard observer is BatchObserverType else {
+            for element in elements {
+                if isFlagSet(state, disposedMask) {
+                    return
+                }
+                do {
+                    if let result = try stage(element) {
+                        forwardOn(.next(result))
+                    }
+                } catch let e {
+                    forwardOn(.error(e))
+                    dispose()
+                    return
+                }
+            }
+            return
+        }
+
+        var results = ContiguousArray<Observer.Element>()
+        results.reserveCapacity(elements.count)
+
+        var failure: Swift.Error?
+        do {
+            for element in elements {
+                if let result = try stage(element) {
+                    results.append(result)
+                }
+            }
+        } catch let e {
+            failure = e
+        }
+
+        results.withUnsafeBufferPointer { forwardOn(batch: $0) }
+
+        if let failure {
+            forwardOn(.error(failure))
+            dispose()
+        }
+    }
+
     final func forwarder() -> SinkForward<Observer> {
         SinkForward(forward: self)
     }
 
+    /// Disposing the subscription stops forwarding right away, before the disposer gets to dispose the sink.
+    private var disposedMask: Int32 {
+        SinkState.sinkDisposed | SinkState.subscriptionDisposed
+    }
+
     final var isDisposed: Bool {
-        isFlagSet(disposed, 1)
+        isFlagSet(state, disposedMask)
+    }
+
+    /// Marks that the source terminated.
+    ///
+    /// - returns: `true` if this is the first terminal event.
+    final func markTerminated() -> Bool {
+        (fetchOr(state, SinkState.sinkTerminated) & SinkState.sinkTerminated) == 0
+    }
+
+    /// Source already sent a terminal event.
+    final var isTerminated: Bool {
+        isFlagSet(state, SinkState.sinkTerminated)
     }
 
     /// Marks the sink as disposed without tearing anything down.
@@ -48,11 +150,11 @@ class Sink<Observer: ObserverType>: Disposable {
     /// at an exact point can set it inside its own critical section and then run the actual
     /// teardown -- which calls out to user code -- after releasing its locks.
     final func markDisposed() {
-        fetchOr(disposed, 1)
+        fetchOr(state, SinkState.sinkDisposed)
     }
 
     func dispose() {
-        fetchOr(disposed, 1)
+        fetchOr(state, SinkState.sinkDisposed)
         cancel.dispose()
     }
 
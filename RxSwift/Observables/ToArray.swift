@@ -23,7 +23,7 @@ public extension ObservableType {
     }
 }
 
-private final class ToArraySink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType where Observer.Element == [SourceType] {
+private final class ToArraySink<SourceType, Observer: ObserverType>: Sink<Observer>, ObserverType, BatchObserverType where Observer.Element == [SourceType] {
     typealias Parent = ToArray<SourceType>
 
     let parent: Parent
@@ -48,6 +48,10 @@ private final class ToArraySink<SourceType, Observer: ObserverType>: Sink<Observ
             dispose()
         }
     }
+
+    func on<BatchElement>(batch elements: UnsafeBufferPointer<BatchElement>) {
+        list.append(contentsOf: elements.assumingElementType(SourceType.self))
+    }
 }
 
 private final class ToArray<SourceType>: Producer<[SourceType]> {
@@ -0,0 +1,87 @@
+//
+//  Trace.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+public extension ObservableType {
+    /**
+     Records subscriptions, events and disposals of this sequence into per-thread binary trace buffers while
+     `Tracing.isEnabled` is `true`.
+
+     Unlike `debug`, nothing is formatted or printed while recording. Records are exported with `Tracing.chromeTrace()`.
+
+     When tracing is disabled at the time of subscription, the source sequence is subscribed to directly.
+
+     - parameter id: Name of the traced stream in the exported trace.
+     - parameter elementHash: Optional function that maps elements to a value recorded with each `next` event, e.g. to follow an element through several traced streams.
+     - returns: The source sequence.
+     */
+    func trace(_ id: String, elementHash: ((Element) -> Int)? = nil) -> Observable<Element> {
+        Trace(source: asObservable(), stream: Tracing.stream(named: id), elementHash: elementHash)
+    }
+}
+
+private final class TraceSink<Observer: ObserverType>: Sink<Observer>, ObserverType {
+    typealias Element = Observer.Element
+
+    private let stream: UInt32
+    private let subscription: UInt32
+    private let elementHash: ((Element) -> Int)?
+
+    init(stream: UInt32, subscription: UInt32, elementHash: ((Element) -> Int)?, observer: Observer, cancel: Cancelable) {
+        self.stream = stream
+        self.subscription = subscription
+        self.elementHash = elementHash
+        super.init(observer: observer, cancel: cancel)
+    }
+
+    func on(_ event: Event<Element>) {
+        switch event {
+        case let .next(element):
+            Tracing.record(.next, stream: stream, subscription: subscription, elementHash: elementHash.map { $0(element) })
+            forwardOn(event)
+        case .error:
+            Tracing.record(.error, stream: stream, subscription: subscription)
+            forwardOn(event)
+            dispose()
+        case .completed:
+            Tracing.record(.completed, stream: stream, subscription: subscription)
+            forwardOn(event)
+            dispose()
+        }
+    }
+}
+
+private final class Trace<Element>: Producer<Element> {
+    private let source: Observable<Element>
+    private let stream: UInt32
+    private let elementHash: ((Element) -> Int)?
+
+    init(source: Observable<Element>, stream: UInt32, elementHash: ((Element) -> Int)?) {
+        self.source = source
+        self.stream = stream
+        self.elementHash = elementHash
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        guard Tracing.isEnabled else {
+            return (sink: Disposables.create(), subscription: source.subscribe(observer))
+        }
+
+        let stream = stream
+        let subscriptionId = Tracing.nextSubscriptionId()
+        Tracing.record(.subscribe, stream: stream, subscription: subscriptionId)
+
+        let sink = TraceSink(stream: stream, subscription: subscriptionId, elementHash: elementHash, observer: observer, cancel: cancel)
+        let subscription = source.subscribe(sink)
+
+        // `SinkDisposer` disposes the subscription exactly once.
+        return (sink: sink, subscription: Disposables.create {
+            subscription.dispose()
+            Tracing.record(.dispose, stream: stream, subscription: subscriptionId)
+        })
+    }
+}
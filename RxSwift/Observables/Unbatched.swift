@@ -0,0 +1,54 @@
+//
+//  Unbatched.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+public extension ObservableType {
+    /**
+     Flattens each array emitted by the source into its elements.
+
+     Each array is passed on as a single batch, so batch-aware operators (`map`, `filter`, `compactMap`, `scan`,
+     `reduce`, `toArray`, `buffer`) process it in a tight loop, while any other observer receives the elements
+     as individual `next` events. This is equivalent to `concatMap { Observable.from($0) }`
+     without the inner subscriptions.
+
+     - returns: An observable sequence whose elements are the elements of the arrays emitted by the source.
+     */
+    func unbatched<Result>() -> Observable<Result> where Element == [Result] {
+        Unbatched(source: asObservable())
+    }
+}
+
+private final class UnbatchedSink<Observer: ObserverType>: Sink<Observer>, ObserverType {
+    typealias Element = [Observer.Element]
+
+    func on(_ event: Event<Element>) {
+        switch event {
+        case let .next(elements):
+            elements.withUnsafeBufferPointer { forwardOn(batch: $0) }
+        case let .error(error):
+            forwardOn(.error(error))
+            dispose()
+        case .completed:
+            forwardOn(.completed)
+            dispose()
+        }
+    }
+}
+
+private final class Unbatched<Element>: Producer<Element> {
+    private let source: Observable<[Element]>
+
+    init(source: Observable<[Element]>) {
+        self.source = source
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        let sink = UnbatchedSink(observer: observer, cancel: cancel)
+        let subscription = source.subscribe(sink)
+        return (sink: sink, subscription: subscription)
+    }
+}
@@ -53,7 +53,7 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
     private enum CalloutAction {
         case none
         case disposeSubscription(SingleAssignmentDisposable)
-        case evaluate([SourceElement])
+        case evaluate
         case forwardCompletedAndDispose
         case forwardErrorAndDispose(Swift.Error)
     }
@@ -68,6 +68,8 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
     private var isStopped = false
     private var numberOfValues = 0
     private var values: [Queue<SourceElement>]
+    // Reused for every emission, it's only copied when the result selector keeps it.
+    private var arguments: [SourceElement]
     private var isDone: [Bool]
     private var numberOfDone = 0
     private var subscriptions: [SingleAssignmentDisposable]
@@ -75,6 +77,8 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
     init(parent: Parent, observer: Observer, cancel: Cancelable) {
         self.parent = parent
         values = [Queue<SourceElement>](repeating: Queue(capacity: 4), count: parent.count)
+        arguments = [SourceElement]()
+        arguments.reserveCapacity(parent.count)
         isDone = [Bool](repeating: false, count: parent.count)
         subscriptions = [SingleAssignmentDisposable]()
         subscriptions.reserveCapacity(parent.count)
@@ -119,8 +123,7 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
                 return .none
             }
 
-            var arguments = [SourceElement]()
-            arguments.reserveCapacity(parent.count)
+            arguments.removeAll(keepingCapacity: true)
 
             // recalculate number of values
             numberOfValues = 0
@@ -132,7 +135,7 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
                 }
             }
 
-            return .evaluate(arguments)
+            return .evaluate
 
         case let .error(error):
             isStopped = true
@@ -161,7 +164,8 @@ private final class ZipCollectionTypeSink<Collection: Swift.Collection, Observer
             return
         case let .disposeSubscription(subscription):
             subscription.dispose()
-        case let .evaluate(arguments):
+        case .evaluate:
+            // `gate` serializes this with the next `nextAction`, which is the only other place that touches `arguments`.
             if isDisposed {
                 return
             }
@@ -21,6 +21,9 @@ class ZipSink<Observer: ObserverType>: Sink<Observer>, ZipSinkProtocol {
 
     // state
     private var isDone: [Bool]
+    private var bufferedCount = 0
+
+    private let metrics = Metrics.register("zip")
 
     init(arity: Int, observer: Observer, cancel: Cancelable) {
         isDone = [Bool](repeating: false, count: arity)
@@ -38,6 +41,9 @@ class ZipSink<Observer: ObserverType>: Sink<Observer>, ZipSinkProtocol {
     }
 
     func next(_: Int) {
+        metrics?.received()
+        bufferedCount += 1
+
         var hasValueAll = true
 
         for i in 0 ..< arity {
@@ -47,10 +53,16 @@ class ZipSink<Observer: ObserverType>: Sink<Observer>, ZipSinkProtocol {
             }
         }
 
+        if hasValueAll {
+            bufferedCount -= arity
+        }
+        metrics?.buffered(bufferedCount)
+
         if hasValueAll {
             do {
                 let result = try getResult()
                 forwardOn(.next(result))
+                metrics?.sent()
             } catch let e {
                 self.forwardOn(.error(e))
                 self.dispose()
@@ -0,0 +1,37 @@
+//
+//  BatchObserverType.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/**
+ Observer that can receive a contiguous chunk of `next` events in a single call.
+
+ Sinks forward batches with `Sink.forwardOn(batch:)`. If the observer doesn't conform to this protocol, the batch is
+ transparently delivered as individual `next` events, so operators that don't understand batches behave exactly
+ as before.
+
+ The protocol has no associated type so `Sink` can discover it on its generic observer at runtime.
+ Conforming types only ever receive batches of their own element type and should rebind them using
+ `assumingElementType(_:)`.
+ */
+protocol BatchObserverType: AnyObject {
+    /// Notifies the observer about a batch of `next` events, in order.
+    ///
+    /// - parameter elements: Elements of the batch. They are only valid for the duration of the call.
+    func on<Element>(batch elements: UnsafeBufferPointer<Element>)
+}
+
+extension UnsafeBufferPointer {
+    /// Returns the same buffer typed as `UnsafeBufferPointer<T>`, where `T` is known to be `Element`.
+    func assumingElementType<T>(_: T.Type) -> UnsafeBufferPointer<T> {
+        #if DEBUG
+        if Element.self != T.self {
+            rxFatalError("Batch of `\(Element.self)` delivered to an observer of `\(T.self)`")
+        }
+        #endif
+        return unsafeBitCast(self, to: UnsafeBufferPointer<T>.self)
+    }
+}
@@ -0,0 +1 @@
+../../../Platform/DataStructures/Deque.swift
\ No newline at end of file
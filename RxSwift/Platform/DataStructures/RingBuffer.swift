@@ -0,0 +1 @@
+../../../Platform/DataStructures/RingBuffer.swift
\ No newline at end of file
@@ -1 +0,0 @@
-../../Platform/Platform.Linux.swift
\ No newline at end of file
@@ -69,7 +69,7 @@ func decrementChecked(_ i: inout Int) throws -> Int {
 import Foundation
 
 final class SynchronizationTracker {
-    private let lock = RecursiveLock()
+    private let lock = SpinLock()
 
     enum SynchronizationErrorMessages: String {
         case variable = "Two different threads are trying to assign the same `Variable.value` unsynchronized.\n    This is undefined behavior because the end result (variable value) is nondeterministic and depends on the \n    operating system thread scheduler. This will cause random behavior of your program.\n"
@@ -7,28 +7,24 @@
 //
 
 import Dispatch
-import Foundation
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#endif
 
-#if !canImport(Darwin)
-fileprivate enum CurrentThreadSchedulerQueueKey {
-    fileprivate static let instance = "RxSwift.CurrentThreadScheduler.Queue"
+/// Per thread trampoline state.
+///
+/// It's created the first time a thread schedules on `CurrentThreadScheduler` and released when the thread exits,
+/// so the queue storage is reused by all trampolines that run on that thread.
+private final class CurrentThreadSchedulerState {
+    var isTrampolineRunning = false
+    var queue = Queue<ScheduledItemType>(capacity: 1)
 }
-#else
-private class CurrentThreadSchedulerQueueKey: NSObject, NSCopying {
-    static let instance = CurrentThreadSchedulerQueueKey()
-    override private init() {
-        super.init()
-    }
-
-    override var hash: Int {
-        0
-    }
-
-    func copy(with _: NSZone? = nil) -> Any {
-        self
-    }
-}
-#endif
 
 /// Represents an object that schedules units of work on the current thread.
 ///
@@ -36,45 +32,61 @@ private class CurrentThreadSchedulerQueueKey: NSObject, NSCopying {
 ///
 /// This scheduler is also sometimes called `trampoline scheduler`.
 public class CurrentThreadScheduler: ImmediateSchedulerType {
-    typealias ScheduleQueue = RxMutableBox<Queue<ScheduledItemType>>
-
     /// The singleton instance of the current thread scheduler.
     public static let instance = CurrentThreadScheduler()
 
-    private static var isScheduleRequiredKey: pthread_key_t = { () -> pthread_key_t in
+    private static let stateKey: pthread_key_t = { () -> pthread_key_t in
         let key = UnsafeMutablePointer<pthread_key_t>.allocate(capacity: 1)
         defer { key.deallocate() }
 
-        guard pthread_key_create(key, nil) == 0 else {
-            rxFatalError("isScheduleRequired key creation failed")
+        #if canImport(Darwin)
+        let destructor: @convention(c) (UnsafeMutableRawPointer) -> Void = { state in
+            Unmanaged<CurrentThreadSchedulerState>.fromOpaque(state).release()
+        }
+        #else
+        let destructor: @convention(c) (UnsafeMutableRawPointer?) -> Void = { state in
+            guard let state else { return }
+            Unmanaged<CurrentThreadSchedulerState>.fromOpaque(state).release()
+        }
+        #endif
+
+        guard pthread_key_create(key, destructor) == 0 else {
+            rxFatalError("CurrentThreadScheduler state key creation failed")
         }
 
         return key.pointee
     }()
 
-    private static var scheduleInProgressSentinel: UnsafeRawPointer = { () -> UnsafeRawPointer in
-        return UnsafeRawPointer(UnsafeMutablePointer<Int>.allocate(capacity: 1))
-    }()
+    /// Trampoline state of the current thread, or `nil` if this thread never scheduled anything.
+    private static var existingState: CurrentThreadSchedulerState? {
+        guard let state = pthread_getspecific(stateKey) else {
+            return nil
+        }
 
-    static var queue: ScheduleQueue? {
-        get {
-            Thread.getThreadLocalStorageValueForKey(CurrentThreadSchedulerQueueKey.instance)
+        return Unmanaged<CurrentThreadSchedulerState>.fromOpaque(state).takeUnretainedValue()
+    }
+
+    private static var state: CurrentThreadSchedulerState {
+        if let existingState {
+            return existingState
         }
-        set {
-            Thread.setThreadLocalStorageValue(newValue, forKey: CurrentThreadSchedulerQueueKey.instance)
+
+        let state = CurrentThreadSchedulerState()
+        if pthread_setspecific(stateKey, Unmanaged.passRetained(state).toOpaque()) != 0 {
+            rxFatalError("pthread_setspecific failed")
         }
+
+        return state
     }
 
     /// Gets a value that indicates whether the caller must call a `schedule` method.
-    public private(set) static var isScheduleRequired: Bool {
-        get {
-            pthread_getspecific(CurrentThreadScheduler.isScheduleRequiredKey) == nil
-        }
-        set(isScheduleRequired) {
-            if pthread_setspecific(CurrentThreadScheduler.isScheduleRequiredKey, isScheduleRequired ? nil : scheduleInProgressSentinel) != 0 {
-                rxFatalError("pthread_setspecific failed")
-            }
-        }
+    public static var isScheduleRequired: Bool {
+        !(existingState?.isTrampolineRunning ?? false)
+    }
+
+    /// Is nothing queued on the trampoline of the current thread.
+    static var isQueueEmpty: Bool {
+        existingState?.queue.isEmpty ?? true
     }
 
     /**
@@ -88,21 +100,18 @@ public class CurrentThreadScheduler: ImmediateSchedulerType {
      - returns: The disposable object used to cancel the scheduled action (best effort).
      */
     public func schedule<StateType>(_ state: StateType, action: @escaping (StateType) -> Disposable) -> Disposable {
-        if CurrentThreadScheduler.isScheduleRequired {
-            CurrentThreadScheduler.isScheduleRequired = false
+        let threadState = CurrentThreadScheduler.state
+
+        if !threadState.isTrampolineRunning {
+            threadState.isTrampolineRunning = true
 
             let disposable = action(state)
 
             defer {
-                CurrentThreadScheduler.isScheduleRequired = true
-                CurrentThreadScheduler.queue = nil
-            }
-
-            guard let queue = CurrentThreadScheduler.queue else {
-                return disposable
+                threadState.isTrampolineRunning = false
             }
 
-            while let latest = queue.value.dequeue() {
+            while let latest = threadState.queue.dequeue() {
                 if latest.isDisposed {
                     continue
                 }
@@ -112,18 +121,8 @@ public class CurrentThreadScheduler: ImmediateSchedulerType {
             return disposable
         }
 
-        let existingQueue = CurrentThreadScheduler.queue
-
-        let queue: RxMutableBox<Queue<ScheduledItemType>>
-        if let existingQueue {
-            queue = existingQueue
-        } else {
-            queue = RxMutableBox(Queue<ScheduledItemType>(capacity: 1))
-            CurrentThreadScheduler.queue = queue
-        }
-
         let scheduledItem = ScheduledItem(action: action, state: state)
-        queue.value.enqueue(scheduledItem)
+        threadState.queue.enqueue(scheduledItem)
 
         return scheduledItem
     }
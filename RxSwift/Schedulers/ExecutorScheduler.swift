@@ -0,0 +1,236 @@
+//
+//  ExecutorScheduler.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#if swift(>=5.7)
+import Dispatch
+import Foundation
+
+/// Maximum number of actions an `ExecutorScheduler` performs per executor hop.
+private let executorDrainBatchSize = 128
+
+/**
+ Abstracts the work that needs to be performed on an actor's executor, or on the global concurrent executor.
+
+ Scheduled actions are performed by tasks, without going through a dispatch queue, so `observe(on:)` and
+ `subscribe(on:)` can deliver events isolated to an actor. A task can't be started on an arbitrary actor's executor
+ directly, so when targeting an actor the task starts on the global concurrent executor and then switches to the
+ actor, which costs two executor hops.
+
+ Actions are performed serially in the order they were scheduled, also when targeting the global concurrent
+ executor. Actions scheduled while the scheduler is busy are performed by the same task, so a burst of actions
+ costs the hops of one task instead of one task per action.
+
+ Timers sleep until an absolute deadline on the monotonic clock, so periodic actions don't drift.
+
+ This scheduler is optimized for `observe(on:)`.
+ */
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+public final class ExecutorScheduler: SchedulerType {
+    public typealias TimeInterval = Foundation.TimeInterval
+    public typealias Time = Date
+
+    public var now: Date {
+        Date()
+    }
+
+    private let priority: TaskPriority?
+    // Starts a task that performs the given work on the target executor.
+    private let hop: (@escaping () -> Void) -> Void
+
+    private let lock = SpinLock()
+
+    // state
+    private var queue = Queue<ScheduledItemType>(capacity: 16)
+    private var isRunning = false
+
+    /**
+     Constructs new `ExecutorScheduler` that performs work isolated to `actor`.
+
+     - parameter actor: Actor whose executor performs scheduled actions, e.g. `MainActor.shared`.
+     - parameter priority: Priority of tasks that perform scheduled actions.
+     */
+    public init<Target: Actor>(actor: Target, priority: TaskPriority? = nil) {
+        self.priority = priority
+        hop = { work in
+            Task.detached(priority: priority) {
+                await performIsolated(to: actor, work)
+            }
+        }
+    }
+
+    /**
+     Constructs new `ExecutorScheduler` that performs work on the global concurrent executor.
+
+     - parameter priority: Priority of tasks that perform scheduled actions.
+     */
+    public init(priority: TaskPriority? = nil) {
+        self.priority = priority
+        hop = { work in
+            Task.detached(priority: priority) {
+                work()
+            }
+        }
+    }
+
+    /**
+     Schedules an action to be executed.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func schedule<StateType>(_ state: StateType, action: @escaping (StateType) -> Disposable) -> Disposable {
+        let scheduledItem = ScheduledItem(action: action, state: state)
+        submit(scheduledItem)
+        return scheduledItem
+    }
+
+    /**
+     Schedules an action to be executed.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter dueTime: Relative time after which to execute the action.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func scheduleRelative<StateType>(_ state: StateType, dueTime: RxTimeInterval, action: @escaping (StateType) -> Disposable) -> Disposable {
+        guard let nanoseconds = dueTime.nanoseconds else {
+            return Disposables.create()
+        }
+
+        let scheduledItem = ScheduledItem(action: action, state: state)
+        let deadline = ExecutorScheduler.deadline(after: nanoseconds)
+
+        let timer = Task.detached(priority: priority) {
+            guard await ExecutorScheduler.sleep(until: deadline) else {
+                return
+            }
+            self.submit(scheduledItem)
+        }
+
+        return Disposables.create(scheduledItem, Disposables.create { timer.cancel() })
+    }
+
+    /**
+     Schedules a periodic piece of work.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter startAfter: Period after which initial work should be run.
+     - parameter period: Period for running the work periodically.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func schedulePeriodic<StateType>(_ state: StateType, startAfter: RxTimeInterval, period: RxTimeInterval, action: @escaping (StateType) -> StateType) -> Disposable {
+        guard let startAfter = startAfter.nanoseconds else {
+            return Disposables.create()
+        }
+
+        let cancel = BooleanDisposable()
+        let periodic = ExecutorPeriodicState(state: state)
+        // A missing period fires once, like a dispatch timer that never repeats.
+        let period = period.nanoseconds.map { Swift.max($0, 1) }
+
+        let timer = Task.detached(priority: priority) {
+            var deadline = ExecutorScheduler.deadline(after: startAfter)
+
+            while await ExecutorScheduler.sleep(until: deadline), !cancel.isDisposed {
+                self.submit(ScheduledItem(action: { _ in
+                    if !cancel.isDisposed {
+                        periodic.state = action(periodic.state)
+                    }
+                    return Disposables.create()
+                }, state: ()))
+
+                guard let period else {
+                    return
+                }
+                deadline = ExecutorScheduler.saturatingAdd(deadline, period)
+            }
+        }
+
+        return Disposables.create {
+            cancel.dispose()
+            timer.cancel()
+        }
+    }
+
+    private func submit(_ item: ScheduledItemType) {
+        let shouldStart = lock.performLocked { () -> Bool in
+            self.queue.enqueue(item)
+            defer { self.isRunning = true }
+            return !self.isRunning
+        }
+
+        if shouldStart {
+            hop(drain)
+        }
+    }
+
+    private func drain() {
+        for _ in 0 ..< executorDrainBatchSize {
+            let item = lock.performLocked { () -> ScheduledItemType? in
+                guard let item = self.queue.dequeue() else {
+                    self.isRunning = false
+                    return nil
+                }
+                return item
+            }
+
+            guard let item else {
+                return
+            }
+
+            if !item.isDisposed {
+                item.invoke()
+            }
+        }
+
+        // The rest is performed on a later hop so other work on the executor isn't starved.
+        hop(drain)
+    }
+
+    /// - returns: Uptime deadline `nanoseconds` from now.
+    private static func deadline(after nanoseconds: Int64) -> UInt64 {
+        saturatingAdd(DispatchTime.now().uptimeNanoseconds, nanoseconds)
+    }
+
+    /// - returns: `deadline` moved by `nanoseconds` into the future, or `UInt64.max` if that doesn't fit.
+    private static func saturatingAdd(_ deadline: UInt64, _ nanoseconds: Int64) -> UInt64 {
+        let (sum, overflow) = deadline.addingReportingOverflow(UInt64(Swift.max(nanoseconds, 0)))
+        return overflow ? UInt64.max : sum
+    }
+
+    /// - returns: `false` if the task was cancelled while sleeping.
+    private static func sleep(until deadline: UInt64) async -> Bool {
+        let now = DispatchTime.now().uptimeNanoseconds
+        if deadline > now {
+            do {
+                try await Task.sleep(nanoseconds: deadline - now)
+            } catch {
+                return false
+            }
+        }
+
+        return !Task.isCancelled
+    }
+}
+
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private func performIsolated<Target: Actor>(to actor: isolated Target, _ work: () -> Void) {
+    work()
+}
+
+/// State of a periodic action, only touched by the serial scheduler.
+private final class ExecutorPeriodicState<State> {
+    var state: State
+
+    init(state: State) {
+        self.state = state
+    }
+}
+#endif
@@ -0,0 +1,47 @@
+//
+//  TrampolineLoop.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/// Recursive action on `CurrentThreadScheduler` that continues in a loop while the trampoline queue is empty.
+final class TrampolineLoop<State>: Disposable {
+    typealias Action = (_ state: State, _ recurse: (State) -> Void) -> Void
+
+    private let action: Action
+    private let scheduled = SerialDisposable()
+
+    init(action: @escaping Action) {
+        self.action = action
+    }
+
+    func schedule(_ state: State) {
+        scheduled.disposable = CurrentThreadScheduler.instance.schedule(state) { state in
+            self.run(state)
+            return Disposables.create()
+        }
+    }
+
+    private func run(_ state: State) {
+        var next: State? = state
+
+        while let state = next, !scheduled.isDisposed {
+            next = nil
+
+            action(state) { nextState in
+                // Other work is queued, so it has to run before the next invocation.
+                if CurrentThreadScheduler.isQueueEmpty {
+                    next = nextState
+                } else {
+                    self.schedule(nextState)
+                }
+            }
+        }
+    }
+
+    func dispose() {
+        scheduled.dispose()
+    }
+}
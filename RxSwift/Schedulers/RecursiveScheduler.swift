@@ -144,7 +144,8 @@ final class AnyRecursiveScheduler<State> {
 final class RecursiveImmediateScheduler<State> {
     typealias Action = (_ state: State, _ recurse: (State) -> Void) -> Void
 
-    private var lock = SpinLock()
+    // Scheduled item disposables are disposed while holding this lock.
+    private var lock = RecursiveLock()
     private let group = CompositeDisposable()
 
     private var action: Action?
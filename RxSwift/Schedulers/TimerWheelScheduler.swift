@@ -0,0 +1,380 @@
+//
+//  TimerWheelScheduler.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+
+/**
+ Abstracts the work that needs to be performed on an internal serial dispatch queue, keeping
+ relative actions in a hierarchical timing wheel.
+
+ All pending relative actions share a single dispatch timer that is armed for the earliest deadline,
+ and actions that become due in the same tick are run by a single timer callback. Scheduling and
+ disposing a relative action is O(1), so operators that re-arm a timer on almost every element
+ (`debounce`, `throttle`, `timeout`, `delay`, `buffer`) don't create and cancel a dispatch timer each time.
+
+ Deadlines are rounded up to the next tick, so relative actions never run early and run at most
+ `resolution` (plus `leeway`) late.
+
+ This scheduler is serial, like `SerialDispatchQueueScheduler`.
+ */
+public final class TimerWheelScheduler: SchedulerType {
+    public typealias TimeInterval = Foundation.TimeInterval
+    public typealias Time = Date
+
+    public var now: Date {
+        Date()
+    }
+
+    private let configuration: DispatchQueueConfiguration
+    private let timer: DispatchSourceTimer
+    private let resolution: UInt64
+    private let startTime: UInt64
+
+    fileprivate let lock = SpinLock()
+
+    // state
+    private var wheel = TimerWheel()
+    private var armedTick = UInt64.max
+
+    // only touched on the queue
+    private var expired = ContiguousArray<TimerWheelItem>()
+
+    /**
+     Constructs new `TimerWheelScheduler` with internal serial queue named `internalSerialQueueName`.
+
+     - parameter internalSerialQueueName: Name of internal serial dispatch queue.
+     - parameter resolution: Length of a wheel tick. Relative actions are coalesced to tick boundaries.
+     - parameter leeway: The amount of time, in nanoseconds, that the system will defer the timer.
+     */
+    public init(internalSerialQueueName: String = "rx.timer_wheel", resolution: RxTimeInterval = .milliseconds(1), leeway: DispatchTimeInterval = DispatchTimeInterval.nanoseconds(0)) {
+        guard let resolution = resolution.nanoseconds, resolution > 0 else {
+            rxFatalError("resolution must be positive")
+        }
+
+        let queue = DispatchQueue(label: internalSerialQueueName, attributes: [])
+        configuration = DispatchQueueConfiguration(queue: queue, leeway: leeway)
+        self.resolution = UInt64(resolution)
+        startTime = DispatchTime.now().uptimeNanoseconds
+
+        timer = DispatchSource.makeTimerSource(queue: queue)
+        timer.schedule(deadline: .distantFuture, leeway: leeway)
+        timer.setEventHandler { [weak self] in
+            self?.fire()
+        }
+        timer.resume()
+    }
+
+    deinit {
+        timer.cancel()
+    }
+
+    /**
+     Schedules an action to be executed immediately.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func schedule<StateType>(_ state: StateType, action: @escaping (StateType) -> Disposable) -> Disposable {
+        configuration.schedule(state, action: action)
+    }
+
+    /**
+     Schedules an action to be executed.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter dueTime: Relative time after which to execute the action.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func scheduleRelative<StateType>(_ state: StateType, dueTime: RxTimeInterval, action: @escaping (StateType) -> Disposable) -> Disposable {
+        guard let dueTime = dueTime.nanoseconds else {
+            return Disposables.create()
+        }
+
+        let now = DispatchTime.now().uptimeNanoseconds - startTime
+        let deadline = now + UInt64(Swift.max(dueTime, 0))
+        let item = TimerWheelItem(scheduler: self, deadlineTick: (deadline + resolution - 1) / resolution) {
+            action(state)
+        }
+
+        lock.performLocked {
+            let fireTick = self.wheel.insert(item, nowTick: now / self.resolution)
+            if fireTick < self.armedTick {
+                self.synchronized_arm(fireTick)
+            }
+        }
+
+        return item
+    }
+
+    private func synchronized_arm(_ tick: UInt64) {
+        armedTick = tick
+        if tick == .max {
+            timer.schedule(deadline: .distantFuture, leeway: configuration.leeway)
+        } else {
+            timer.schedule(deadline: DispatchTime(uptimeNanoseconds: startTime + tick * resolution), leeway: configuration.leeway)
+        }
+    }
+
+    private func fire() {
+        let nowTick = (DispatchTime.now().uptimeNanoseconds - startTime) / resolution
+
+        lock.performLocked {
+            self.wheel.advance(to: nowTick, expired: &self.expired)
+            self.synchronized_arm(self.wheel.nextExpirationTick() ?? .max)
+        }
+
+        for item in expired {
+            invoke(item)
+        }
+        expired.removeAll(keepingCapacity: true)
+    }
+
+    private func invoke(_ item: TimerWheelItem) {
+        let action = lock.performLocked { () -> (() -> Disposable)? in
+            defer { item.action = nil }
+            return item.action
+        }
+
+        guard let action, !item.isDisposed else {
+            return
+        }
+
+        let disposable = action()
+
+        let isDisposed = lock.performLocked { () -> Bool in
+            if item.isDisposed {
+                return true
+            }
+            item.disposable = disposable
+            return false
+        }
+
+        if isDisposed {
+            disposable.dispose()
+        }
+    }
+
+    fileprivate func cancel(_ item: TimerWheelItem) {
+        let disposable = lock.performLocked { () -> Disposable? in
+            self.wheel.remove(item)
+            item.action = nil
+            defer { item.disposable = nil }
+            return item.disposable
+        }
+
+        disposable?.dispose()
+    }
+}
+
+private final class TimerWheelItem: Cancelable {
+    private let scheduler: TimerWheelScheduler
+    private let disposed = AtomicInt(0)
+
+    let deadlineTick: UInt64
+
+    // state, guarded by `scheduler.lock`
+    var action: (() -> Disposable)?
+    var disposable: Disposable?
+    var previous: TimerWheelItem?
+    var next: TimerWheelItem?
+    var level = TimerWheel.notScheduled
+    var slot = 0
+
+    init(scheduler: TimerWheelScheduler, deadlineTick: UInt64, action: @escaping () -> Disposable) {
+        self.scheduler = scheduler
+        self.deadlineTick = deadlineTick
+        self.action = action
+    }
+
+    var isDisposed: Bool {
+        isFlagSet(disposed, 1)
+    }
+
+    func dispose() {
+        if fetchOr(disposed, 1) == 0 {
+            scheduler.cancel(self)
+        }
+    }
+}
+
+/**
+ Hierarchical timing wheel.
+
+ Level `n` has 64 slots, each covering `64^n` ticks. Items are kept in doubly linked lists per slot,
+ so insertion and removal are O(1). When the current tick crosses a slot boundary of a higher level,
+ the items of that slot are redistributed to lower levels. Items that are farther away than the
+ whole wheel covers are parked in the top level and redistributed until they fit.
+ */
+private struct TimerWheel {
+    static let notScheduled = -1
+
+    private static let levelCount = 4
+    private static let slotBits: UInt64 = 6
+    private static let slotCount = 1 << slotBits
+    private static let slotMask = UInt64(slotCount - 1)
+
+    private var slots = ContiguousArray<TimerWheelItem?>(repeating: nil, count: levelCount * slotCount)
+    private var occupancy = ContiguousArray<UInt64>(repeating: 0, count: levelCount)
+    private var count = 0
+
+    private(set) var currentTick: UInt64 = 0
+
+    /// Inserts `item` and returns the tick at which it will fire.
+    mutating func insert(_ item: TimerWheelItem, nowTick: UInt64) -> UInt64 {
+        if count == 0, nowTick > currentTick {
+            currentTick = nowTick
+        }
+        count += 1
+
+        return link(item)
+    }
+
+    mutating func remove(_ item: TimerWheelItem) {
+        guard item.level != TimerWheel.notScheduled else {
+            return
+        }
+
+        unlink(item)
+        count -= 1
+    }
+
+    /// Advances the wheel to `target` tick and appends items that became due to `expired`.
+    mutating func advance(to target: UInt64, expired: inout ContiguousArray<TimerWheelItem>) {
+        while currentTick < target {
+            if count == 0 {
+                currentTick = target
+                return
+            }
+
+            var emptyLevels = 0
+            while occupancy[emptyLevels] == 0 {
+                emptyLevels += 1
+            }
+
+            if emptyLevels > 0 {
+                // Nothing can happen before the next slot boundary of the lowest occupied level.
+                let shift = TimerWheel.slotBits * UInt64(emptyLevels)
+                currentTick = Swift.min(target, ((currentTick >> shift) + 1) << shift) - 1
+            }
+
+            currentTick += 1
+
+            var crossedLevels = 1
+            while crossedLevels < TimerWheel.levelCount, currentTick & ((1 << (TimerWheel.slotBits * UInt64(crossedLevels))) - 1) == 0 {
+                crossedLevels += 1
+            }
+
+            for level in stride(from: crossedLevels - 1, through: 1, by: -1) {
+                for item in takeSlot(level: level, slot: slotIndex(of: currentTick, level: level)) {
+                    if item.deadlineTick <= currentTick {
+                        count -= 1
+                        expired.append(item)
+                    } else {
+                        _ = link(item)
+                    }
+                }
+            }
+
+            for item in takeSlot(level: 0, slot: slotIndex(of: currentTick, level: 0)) {
+                count -= 1
+                expired.append(item)
+            }
+        }
+    }
+
+    /// Earliest tick at which an item can become due or has to be moved to a lower level.
+    func nextExpirationTick() -> UInt64? {
+        var next: UInt64?
+
+        for level in 0 ..< TimerWheel.levelCount where occupancy[level] != 0 {
+            let shift = TimerWheel.slotBits * UInt64(level)
+            let start = (slotIndex(of: currentTick, level: level) + 1) & Int(TimerWheel.slotMask)
+            let bits = occupancy[level]
+            let rotated = start == 0 ? bits : (bits >> UInt64(start)) | (bits << UInt64(TimerWheel.slotCount - start))
+            let distance = UInt64(rotated.trailingZeroBitCount) + 1
+            let tick = ((currentTick >> shift) + distance) << shift
+            next = Swift.min(next ?? .max, tick)
+        }
+
+        return next
+    }
+
+    private func slotIndex(of tick: UInt64, level: Int) -> Int {
+        Int((tick >> (TimerWheel.slotBits * UInt64(level))) & TimerWheel.slotMask)
+    }
+
+    private mutating func link(_ item: TimerWheelItem) -> UInt64 {
+        let tick = Swift.max(item.deadlineTick, currentTick + 1)
+        let delta = tick - currentTick
+
+        var level = 0
+        while level < TimerWheel.levelCount - 1, delta >> (TimerWheel.slotBits * UInt64(level + 1)) != 0 {
+            level += 1
+        }
+
+        let slot: Int
+        if delta >> (TimerWheel.slotBits * UInt64(TimerWheel.levelCount)) != 0 {
+            // Too far away, park it in the top level slot that is redistributed last.
+            slot = (slotIndex(of: currentTick, level: level) + TimerWheel.slotCount - 1) & Int(TimerWheel.slotMask)
+        } else {
+            slot = slotIndex(of: tick, level: level)
+        }
+
+        let index = level * TimerWheel.slotCount + slot
+        item.level = level
+        item.slot = slot
+        item.previous = nil
+        item.next = slots[index]
+        slots[index]?.previous = item
+        slots[index] = item
+        occupancy[level] |= 1 << UInt64(slot)
+
+        return tick
+    }
+
+    private mutating func unlink(_ item: TimerWheelItem) {
+        let index = item.level * TimerWheel.slotCount + item.slot
+
+        if let previous = item.previous {
+            previous.next = item.next
+        } else {
+            slots[index] = item.next
+        }
+        item.next?.previous = item.previous
+
+        if slots[index] == nil {
+            occupancy[item.level] &= ~(1 << UInt64(item.slot))
+        }
+
+        item.previous = nil
+        item.next = nil
+        item.level = TimerWheel.notScheduled
+    }
+
+    private mutating func takeSlot(level: Int, slot: Int) -> ContiguousArray<TimerWheelItem> {
+        let index = level * TimerWheel.slotCount + slot
+        var items = ContiguousArray<TimerWheelItem>()
+
+        var current = slots[index]
+        while let item = current {
+            current = item.next
+            item.previous = nil
+            item.next = nil
+            item.level = TimerWheel.notScheduled
+            items.append(item)
+        }
+
+        slots[index] = nil
+        occupancy[level] &= ~(1 << UInt64(slot))
+
+        return items
+    }
+}
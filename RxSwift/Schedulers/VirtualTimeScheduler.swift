@@ -22,6 +22,10 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
     private var schedulerQueue: PriorityQueue<VirtualSchedulerItem<VirtualTime>>
     private var converter: Converter
 
+    // Items that ran or were disposed, reused by later schedules.
+    private var itemPool = [VirtualSchedulerItem<VirtualTime>]()
+    private let maxItemPoolSize = 1024
+
     private var nextId = 0
 
     private let thread: Thread
@@ -53,7 +57,7 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
             case .greaterThan:
                 false
             }
-        }, isEqual: { $0 === $1 })
+        })
         #if TRACE_RESOURCES
         _ = Resources.incrementTotal()
         #endif
@@ -67,9 +71,7 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
      - returns: The disposable object used to cancel the scheduled action (best effort).
      */
     public func schedule<StateType>(_ state: StateType, action: @escaping (StateType) -> Disposable) -> Disposable {
-        scheduleRelative(state, dueTime: .microseconds(0)) { a in
-            action(a)
-        }
+        scheduleRelative(state, dueTime: .microseconds(0), action: action)
     }
 
     /**
@@ -110,19 +112,26 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
      */
     public func scheduleAbsoluteVirtual<StateType>(_ state: StateType, time: VirtualTime, action: @escaping (StateType) -> Disposable) -> Disposable {
         ensureRunningOnCorrectThread()
-        let compositeDisposable = CompositeDisposable()
 
-        let item = VirtualSchedulerItem(action: {
+        let itemAction = {
             action(state)
-        }, time: time, id: nextId)
+        }
+
+        let item: VirtualSchedulerItem<VirtualTime>
+        let generation: Int
+        if let reused = itemPool.popLast() {
+            generation = reused.reuse(action: itemAction, time: time, id: nextId)
+            item = reused
+        } else {
+            item = VirtualSchedulerItem(action: itemAction, time: time, id: nextId)
+            generation = 0
+        }
 
         nextId += 1
 
         schedulerQueue.enqueue(item)
 
-        _ = compositeDisposable.insert(item)
-
-        return compositeDisposable
+        return VirtualSchedulerItemDisposable(item: item, generation: generation)
     }
 
     /// Adjusts time of scheduling before adding item to schedule queue.
@@ -148,16 +157,17 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
             }
 
             next.invoke()
-            schedulerQueue.remove(next)
+            remove(next)
         } while running
 
         running = false
     }
 
     func findNext() -> VirtualSchedulerItem<VirtualTime>? {
+        // Disposed items are removed lazily, once they reach the front.
         while let front = schedulerQueue.peek() {
             if front.isDisposed {
-                schedulerQueue.remove(front)
+                remove(front)
                 continue
             }
 
@@ -167,6 +177,14 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
         return nil
     }
 
+    private func remove(_ item: VirtualSchedulerItem<VirtualTime>) {
+        schedulerQueue.remove(item)
+
+        if item.isReusable, itemPool.count < maxItemPoolSize {
+            itemPool.append(item)
+        }
+    }
+
     /// Advances the scheduler's clock to the specified time, running all work till that point.
     ///
     /// - parameter virtualTime: Absolute time to advance the scheduler's clock to.
@@ -190,7 +208,7 @@ open class VirtualTimeScheduler<Converter: VirtualTimeConverterType>:
                 currentClock = next.time
             }
             next.invoke()
-            schedulerQueue.remove(next)
+            remove(next)
         } while running
 
         currentClock = virtualTime
@@ -236,20 +254,28 @@ extension VirtualTimeScheduler: CustomDebugStringConvertible {
     }
 }
 
-final class VirtualSchedulerItem<Time>:
-    Disposable
-{
+/// Scheduled action.
+///
+/// Items are pooled by the scheduler, so the disposable returned to the caller is a `VirtualSchedulerItemDisposable`
+/// that only affects the item while its generation matches.
+///
+/// Everything except disposal happens on the scheduler's thread. Disposal can happen on any thread, so the state it
+/// touches is guarded by `lock`.
+final class VirtualSchedulerItem<Time>: PriorityQueueElement {
     typealias Action = () -> Disposable
 
-    let action: Action
-    let time: Time
-    let id: Int
+    private let lock = SpinLock()
 
-    var isDisposed: Bool {
-        disposable.isDisposed
-    }
+    private(set) var time: Time
+    private(set) var id: Int
+
+    var priorityQueueIndex: Int?
 
-    var disposable = SingleAssignmentDisposable()
+    // state, guarded by `lock`
+    private var action: Action?
+    private var generation = 0
+    private var disposable: Disposable?
+    private var disposed = false
 
     init(action: @escaping Action, time: Time, id: Int) {
         self.action = action
@@ -257,12 +283,75 @@ final class VirtualSchedulerItem<Time>:
         self.id = id
     }
 
+    var isDisposed: Bool {
+        lock.performLocked { self.disposed }
+    }
+
+    /// An item can be reused once it's not enqueued and there is no result of its action that would still need disposing.
+    var isReusable: Bool {
+        priorityQueueIndex == nil && lock.performLocked { self.disposable == nil }
+    }
+
+    /// - returns: Generation of the item, which disposables returned for this schedule have to match.
+    func reuse(action: @escaping Action, time: Time, id: Int) -> Int {
+        self.time = time
+        self.id = id
+
+        return lock.performLocked {
+            self.generation += 1
+            self.action = action
+            self.disposed = false
+            return self.generation
+        }
+    }
+
     func invoke() {
-        disposable.setDisposable(action())
+        let action = lock.performLocked { () -> Action? in
+            defer { self.action = nil }
+            return self.disposed ? nil : self.action
+        }
+
+        guard let action else {
+            return
+        }
+
+        let disposable = action()
+
+        let isDisposed = lock.performLocked { () -> Bool in
+            if !self.disposed, !Disposables.isNoOp(disposable) {
+                self.disposable = disposable
+            }
+            return self.disposed
+        }
+
+        if isDisposed {
+            disposable.dispose()
+        }
     }
 
+    func dispose(generation: Int) {
+        let disposable = lock.performLocked { () -> Disposable? in
+            guard generation == self.generation, !self.disposed else {
+                return nil
+            }
+
+            self.disposed = true
+            self.action = nil
+
+            defer { self.disposable = nil }
+            return self.disposable
+        }
+
+        disposable?.dispose()
+    }
+}
+
+struct VirtualSchedulerItemDisposable<Time>: Disposable {
+    let item: VirtualSchedulerItem<Time>
+    let generation: Int
+
     func dispose() {
-        disposable.dispose()
+        item.dispose(generation: generation)
     }
 }
 
@@ -0,0 +1,271 @@
+//
+//  WorkStealingScheduler.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#endif
+
+/**
+ Abstracts the work that needs to be performed on a fixed pool of workers that steal work from each other.
+
+ Actions scheduled from outside of the pool are distributed round-robin over the workers, and every worker
+ runs them in order. Actions scheduled while running on a worker (e.g. by `scheduleRecursive`) are pushed
+ to that worker's own deque and run next on the same worker, which keeps the data they touch in the same
+ CPU cache. To keep older actions from starving, a worker periodically runs its oldest action instead.
+ Idle workers steal the oldest actions from busy workers.
+
+ Workers run on a global concurrent dispatch queue only while they have work, so an idle pool doesn't
+ occupy any threads.
+
+ This scheduler is concurrent and doesn't guarantee any order of execution.
+ */
+public final class WorkStealingScheduler: SchedulerType {
+    public typealias TimeInterval = Foundation.TimeInterval
+    public typealias Time = Date
+
+    public var now: Date {
+        Date()
+    }
+
+    private let pool: WorkStealingPool
+    private let timerConfiguration: DispatchQueueConfiguration
+
+    /**
+     Constructs new `WorkStealingScheduler`.
+
+     - parameter workerCount: Number of workers, defaults to the number of active processors.
+     - parameter qos: Quality of service class of worker threads.
+     - parameter leeway: The amount of time, in nanoseconds, that the system will defer the timer.
+     */
+    public init(workerCount: Int = ProcessInfo.processInfo.activeProcessorCount, qos: DispatchQoS = .default, leeway: DispatchTimeInterval = DispatchTimeInterval.nanoseconds(0)) {
+        guard workerCount > 0 else {
+            rxFatalError("workerCount must be positive")
+        }
+
+        pool = WorkStealingPool(workerCount: workerCount, queue: DispatchQueue.global(qos: qos.qosClass))
+        timerConfiguration = DispatchQueueConfiguration(
+            queue: DispatchQueue(label: "rxswift.work_stealing.timer", qos: qos),
+            leeway: leeway
+        )
+    }
+
+    /// Number of workers.
+    public var workerCount: Int {
+        pool.workers.count
+    }
+
+    /**
+     Schedules an action to be executed.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func schedule<StateType>(_ state: StateType, action: @escaping (StateType) -> Disposable) -> Disposable {
+        let scheduledItem = ScheduledItem(action: action, state: state)
+        pool.submit(scheduledItem)
+        return scheduledItem
+    }
+
+    /**
+     Schedules an action to be executed.
+
+     - parameter state: State passed to the action to be executed.
+     - parameter dueTime: Relative time after which to execute the action.
+     - parameter action: Action to be executed.
+     - returns: The disposable object used to cancel the scheduled action (best effort).
+     */
+    public func scheduleRelative<StateType>(_ state: StateType, dueTime: RxTimeInterval, action: @escaping (StateType) -> Disposable) -> Disposable {
+        timerConfiguration.scheduleRelative(state, dueTime: dueTime) { [pool] state in
+            let scheduledItem = ScheduledItem(action: action, state: state)
+            pool.submit(scheduledItem)
+            return scheduledItem
+        }
+    }
+}
+
+/// Maximum number of items a worker takes from the back of its deque before it takes the oldest queued item.
+private let workStealingFairnessBound = 32
+
+private final class WorkStealingWorker {
+    private let lock = SpinLock()
+
+    // state
+    // Items scheduled from the worker itself, run newest first.
+    private var deque = Deque<ScheduledItemType>(capacity: 16)
+    // Items scheduled from outside of the pool, run in order.
+    private var inbox = Queue<ScheduledItemType>(capacity: 16)
+    private var localStreak = 0
+    private var isActive = false
+
+    unowned let pool: WorkStealingPool
+    let index: Int
+
+    init(pool: WorkStealingPool, index: Int) {
+        self.pool = pool
+        self.index = index
+    }
+
+    /// Pushes `item` and returns `true` if the worker was idle and needs to be started.
+    func push(_ item: ScheduledItemType) -> Bool {
+        lock.performLocked {
+            self.inbox.enqueue(item)
+            defer { self.isActive = true }
+            return !self.isActive
+        }
+    }
+
+    /// Pushes `item` from the worker itself and returns the number of queued items.
+    func pushLocal(_ item: ScheduledItemType) -> Int {
+        lock.performLocked {
+            self.deque.pushBack(item)
+            return self.deque.count + self.inbox.count
+        }
+    }
+
+    /// Takes the newest local item, but every `workStealingFairnessBound` items the oldest item instead,
+    /// so a stream of new local work can't starve older items.
+    func popLocal() -> ScheduledItemType? {
+        lock.performLocked {
+            if self.localStreak >= workStealingFairnessBound || self.deque.isEmpty {
+                self.localStreak = 0
+                return self.inbox.dequeue() ?? self.deque.popFront()
+            }
+
+            self.localStreak += 1
+            return self.deque.popBack()
+        }
+    }
+
+    func steal() -> ScheduledItemType? {
+        lock.performLocked { self.inbox.dequeue() ?? self.deque.popFront() }
+    }
+
+    func activateIfIdle() -> Bool {
+        lock.performLocked {
+            defer { self.isActive = true }
+            return !self.isActive
+        }
+    }
+
+    func deactivateIfEmpty() -> Bool {
+        lock.performLocked {
+            if !self.deque.isEmpty || !self.inbox.isEmpty {
+                return false
+            }
+            self.isActive = false
+            return true
+        }
+    }
+}
+
+private final class WorkStealingPool {
+    private static let currentWorkerKey: pthread_key_t = { () -> pthread_key_t in
+        let key = UnsafeMutablePointer<pthread_key_t>.allocate(capacity: 1)
+        defer { key.deallocate() }
+
+        guard pthread_key_create(key, nil) == 0 else {
+            rxFatalError("WorkStealingScheduler worker key creation failed")
+        }
+
+        return key.pointee
+    }()
+
+    private static var currentWorker: WorkStealingWorker? {
+        guard let worker = pthread_getspecific(currentWorkerKey) else {
+            return nil
+        }
+
+        return Unmanaged<WorkStealingWorker>.fromOpaque(worker).takeUnretainedValue()
+    }
+
+    private let queue: DispatchQueue
+    private let nextWorker = AtomicInt(0)
+    private let activeWorkers = AtomicInt(0)
+
+    private(set) var workers = [WorkStealingWorker]()
+
+    init(workerCount: Int, queue: DispatchQueue) {
+        self.queue = queue
+        workers = (0 ..< workerCount).map { WorkStealingWorker(pool: self, index: $0) }
+    }
+
+    func submit(_ item: ScheduledItemType) {
+        if let worker = WorkStealingPool.currentWorker, worker.pool === self {
+            // Somebody else could help with the backlog.
+            if worker.pushLocal(item) > 1, Int(load(activeWorkers)) < workers.count {
+                wakeIdleWorker()
+            }
+            return
+        }
+
+        let worker = workers[Int(UInt32(bitPattern: increment(nextWorker)) % UInt32(workers.count))]
+        if worker.push(item) {
+            start(worker)
+        }
+    }
+
+    private func wakeIdleWorker() {
+        for worker in workers where worker.activateIfIdle() {
+            start(worker)
+            return
+        }
+    }
+
+    private func start(_ worker: WorkStealingWorker) {
+        increment(activeWorkers)
+        queue.async {
+            self.run(worker)
+        }
+    }
+
+    private func run(_ worker: WorkStealingWorker) {
+        pthread_setspecific(WorkStealingPool.currentWorkerKey, Unmanaged.passUnretained(worker).toOpaque())
+        defer {
+            pthread_setspecific(WorkStealingPool.currentWorkerKey, nil)
+        }
+
+        while true {
+            if let item = worker.popLocal() ?? steal(for: worker) {
+                if !item.isDisposed {
+                    item.invoke()
+                }
+                continue
+            }
+
+            // Check the own deque once more under the worker lock, somebody could have pushed meanwhile.
+            if worker.deactivateIfEmpty() {
+                decrement(activeWorkers)
+                return
+            }
+        }
+    }
+
+    private func steal(for worker: WorkStealingWorker) -> ScheduledItemType? {
+        for offset in 1 ..< workers.count {
+            var index = worker.index + offset
+            if index >= workers.count {
+                index -= workers.count
+            }
+
+            if let item = workers[index].steal() {
+                return item
+            }
+        }
+
+        return nil
+    }
+}
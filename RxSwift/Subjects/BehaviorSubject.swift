@@ -18,7 +18,7 @@ public final class BehaviorSubject<Element>:
 {
     public typealias SubjectObserverType = BehaviorSubject<Element>
 
-    typealias Observers = AnyObserver<Element>.s
+    typealias Observers = SnapshotBag<(Event<Element>) -> Void>
     typealias DisposeKey = Observers.KeyType
 
     /// Indicates whether the subject has any observers
@@ -82,10 +82,10 @@ public final class BehaviorSubject<Element>:
         dispatch(synchronized_on(event), event)
     }
 
-    func synchronized_on(_ event: Event<Element>) -> Observers {
+    func synchronized_on(_ event: Event<Element>) -> Observers.Snapshot {
         lock.lock(); defer { self.lock.unlock() }
         if stoppedEvent != nil || isDisposed {
-            return Observers()
+            return Observers.Snapshot()
         }
 
         switch event {
@@ -95,7 +95,7 @@ public final class BehaviorSubject<Element>:
             stoppedEvent = event
         }
 
-        return observers
+        return observers.snapshot()
     }
 
     /// Subscribes an observer to the subject.
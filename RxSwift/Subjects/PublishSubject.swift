@@ -18,7 +18,7 @@ public final class PublishSubject<Element>:
 {
     public typealias SubjectObserverType = PublishSubject<Element>
 
-    typealias Observers = AnyObserver<Element>.s
+    typealias Observers = SnapshotBag<(Event<Element>) -> Void>
     typealias DisposeKey = Observers.KeyType
 
     /// Indicates whether the subject has any observers
@@ -62,25 +62,25 @@ public final class PublishSubject<Element>:
         dispatch(synchronized_on(event), event)
     }
 
-    func synchronized_on(_ event: Event<Element>) -> Observers {
+    func synchronized_on(_ event: Event<Element>) -> Observers.Snapshot {
         lock.lock(); defer { self.lock.unlock() }
         switch event {
         case .next:
             if isDisposed || stopped {
-                return Observers()
+                return Observers.Snapshot()
             }
 
-            return observers
+            return observers.snapshot()
         case .completed, .error:
             if stoppedEvent == nil {
                 stoppedEvent = event
                 stopped = true
-                let observers = observers
+                let observers = self.observers.snapshot()
                 self.observers.removeAll()
                 return observers
             }
 
-            return Observers()
+            return Observers.Snapshot()
         }
     }
 
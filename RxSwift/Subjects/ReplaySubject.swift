@@ -17,7 +17,7 @@ public class ReplaySubject<Element>:
 {
     public typealias SubjectObserverType = ReplaySubject<Element>
 
-    typealias Observers = AnyObserver<Element>.s
+    typealias Observers = SnapshotBag<(Event<Element>) -> Void>
     typealias DisposeKey = Observers.KeyType
 
     /// Indicates whether the subject has any observers
@@ -80,6 +80,20 @@ public class ReplaySubject<Element>:
         ReplayAll()
     }
 
+    /// Creates new instance of `ReplaySubject` that replays at most `bufferSize` last elements of sequence
+    /// that were received during the last `window` time.
+    ///
+    /// Elements are timestamped with `scheduler.now` when they are received. Expired elements are released
+    /// when new elements are received or observers subscribe.
+    ///
+    /// - parameter bufferSize: Maximal number of elements to replay to observer after subscription.
+    /// - parameter window: Maximal age of elements to replay to observer after subscription.
+    /// - parameter scheduler: Scheduler used to timestamp elements.
+    /// - returns: New instance of replay subject.
+    public static func create(bufferSize: Int, window: RxTimeInterval, scheduler: SchedulerType) -> ReplaySubject<Element> {
+        ReplayTimeWindow(bufferSize: bufferSize, window: window, scheduler: scheduler)
+    }
+
     #if TRACE_RESOURCES
     override init() {
         _ = Resources.incrementTotal()
@@ -95,10 +109,16 @@ private class ReplayBufferBase<Element>:
     ReplaySubject<Element>,
     SynchronizedUnsubscribeType
 {
+    private let metrics = Metrics.register("replaySubject")
+
     func trim() {
         rxAbstractMethod()
     }
 
+    var bufferCount: Int {
+        rxAbstractMethod()
+    }
+
     func addValueToBuffer(_: Element) {
         rxAbstractMethod()
     }
@@ -115,25 +135,27 @@ private class ReplayBufferBase<Element>:
         dispatch(synchronized_on(event), event)
     }
 
-    func synchronized_on(_ event: Event<Element>) -> Observers {
+    func synchronized_on(_ event: Event<Element>) -> Observers.Snapshot {
         lock.lock(); defer { self.lock.unlock() }
         if isDisposed {
-            return Observers()
+            return Observers.Snapshot()
         }
 
         if isStopped {
-            return Observers()
+            return Observers.Snapshot()
         }
 
         switch event {
         case let .next(element):
             addValueToBuffer(element)
             trim()
-            return observers
+            metrics?.received()
+            metrics?.buffered(bufferCount)
+            return observers.snapshot()
         case .error, .completed:
             stoppedEvent = event
             trim()
-            let observers = observers
+            let observers = self.observers.snapshot()
             self.observers.removeAll()
             return observers
         }
@@ -143,7 +165,7 @@ private class ReplayBufferBase<Element>:
         let subscription = lock.performLocked { self.synchronized_subscribe(observer) }
 
         if let replayObserver = subscription.replayObserver {
-            replayObserver.replay(subscription.replayBuffer)
+            replayObserver.replay { subscription.replayBuffer.replay($0) }
         } else {
             subscription.replayBuffer.replay(observer)
 
@@ -195,13 +217,15 @@ private class ReplayBufferBase<Element>:
     func synchronized_dispose() {
         isDisposed = true
         observers.removeAll()
+        metrics?.buffered(0)
     }
 }
 
 private enum ReplayBufferSnapshot<Element> {
     case empty
     case one(Element)
-    case many(Queue<Element>)
+    case many(SegmentedBuffer<Element>.Snapshot)
+    case timed(SegmentedBuffer<TimestampedElement<Element>>.Snapshot)
 
     func replay<Observer: ObserverType>(_ observer: Observer) where Observer.Element == Element {
         switch self {
@@ -209,15 +233,20 @@ private enum ReplayBufferSnapshot<Element> {
             break
         case let .one(value):
             observer.on(.next(value))
-        case let .many(queue):
-            for value in queue {
+        case let .many(values):
+            for value in values {
                 observer.on(.next(value))
             }
+        case let .timed(values):
+            for value in values {
+                observer.on(.next(value.element))
+            }
         }
     }
 }
 
-private final class ReplaySubjectSubscriptionObserver<Observer: ObserverType>: ObserverType {
+/// Buffers live events until the replay of a new subscription is done.
+final class ReplaySubjectSubscriptionObserver<Observer: ObserverType>: ObserverType {
     typealias Element = Observer.Element
 
     private let lock = RecursiveLock()
@@ -244,8 +273,9 @@ private final class ReplaySubjectSubscriptionObserver<Observer: ObserverType>: O
         }
     }
 
-    func replay(_ replayBuffer: ReplayBufferSnapshot<Element>) {
-        replayBuffer.replay(observer)
+    /// Calls `replayElements` with the observer and then delivers live events received in the meantime.
+    func replay(_ replayElements: (Observer) -> Void) {
+        replayElements(observer)
 
         while let event = lock.performLocked({ () -> Event<Element>? in
             if let event = pendingEvents.dequeue() {
@@ -277,6 +307,10 @@ private final class ReplayOne<Element>: ReplayBufferBase<Element> {
 
     override func trim() {}
 
+    override var bufferCount: Int {
+        value == nil ? 0 : 1
+    }
+
     override func addValueToBuffer(_ value: Element) {
         self.value = value
     }
@@ -295,24 +329,31 @@ private final class ReplayOne<Element>: ReplayBufferBase<Element> {
     }
 }
 
+// Segments are never larger than needed for bounded buffers, and big enough to amortize allocations otherwise.
+private let maxReplaySegmentCapacity = 64
+
 private class ReplayManyBase<Element>: ReplayBufferBase<Element> {
-    fileprivate var queue: Queue<Element>
+    fileprivate var buffer: SegmentedBuffer<Element>
+
+    init(segmentCapacity: Int) {
+        buffer = SegmentedBuffer(segmentCapacity: segmentCapacity)
+    }
 
-    init(queueSize: Int) {
-        queue = Queue(capacity: queueSize + 1)
+    override var bufferCount: Int {
+        buffer.count
     }
 
     override func addValueToBuffer(_ value: Element) {
-        queue.enqueue(value)
+        buffer.append(value)
     }
 
     override func replayBuffer() -> ReplayBufferSnapshot<Element> {
-        .many(queue)
+        .many(buffer.snapshot())
     }
 
     override func synchronized_dispose() {
         super.synchronized_dispose()
-        queue = Queue(capacity: 0)
+        buffer.removeAll()
     }
 }
 
@@ -322,20 +363,69 @@ private final class ReplayMany<Element>: ReplayManyBase<Element> {
     init(bufferSize: Int) {
         self.bufferSize = bufferSize
 
-        super.init(queueSize: bufferSize)
+        super.init(segmentCapacity: Swift.min(bufferSize, maxReplaySegmentCapacity))
     }
 
     override func trim() {
-        while queue.count > bufferSize {
-            _ = queue.dequeue()
+        while buffer.count > bufferSize {
+            buffer.removeFirst()
         }
     }
 }
 
 private final class ReplayAll<Element>: ReplayManyBase<Element> {
     init() {
-        super.init(queueSize: 0)
+        super.init(segmentCapacity: maxReplaySegmentCapacity)
     }
 
     override func trim() {}
 }
+
+private struct TimestampedElement<Element> {
+    let time: RxTime
+    let element: Element
+}
+
+private final class ReplayTimeWindow<Element>: ReplayBufferBase<Element> {
+    private let bufferSize: Int
+    private let window: RxTimeInterval
+    private let scheduler: SchedulerType
+
+    private var buffer: SegmentedBuffer<TimestampedElement<Element>>
+
+    init(bufferSize: Int, window: RxTimeInterval, scheduler: SchedulerType) {
+        self.bufferSize = bufferSize
+        self.window = window
+        self.scheduler = scheduler
+        buffer = SegmentedBuffer(segmentCapacity: Swift.min(bufferSize, maxReplaySegmentCapacity))
+    }
+
+    override var bufferCount: Int {
+        buffer.count
+    }
+
+    override func trim() {
+        while buffer.count > bufferSize {
+            buffer.removeFirst()
+        }
+
+        let now = scheduler.now
+        while let first = buffer.first, first.time.addingDispatchInterval(window) <= now {
+            buffer.removeFirst()
+        }
+    }
+
+    override func addValueToBuffer(_ value: Element) {
+        buffer.append(TimestampedElement(time: scheduler.now, element: value))
+    }
+
+    override func replayBuffer() -> ReplayBufferSnapshot<Element> {
+        trim()
+        return .timed(buffer.snapshot())
+    }
+
+    override func synchronized_dispose() {
+        super.synchronized_dispose()
+        buffer.removeAll()
+    }
+}
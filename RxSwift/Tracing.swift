@@ -0,0 +1,300 @@
+//
+//  Tracing.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Android)
+import Android
+#endif
+
+/**
+ Binary event tracing for `trace(_:elementHash:)`.
+
+ Every thread records into its own fixed-size ring buffer, so recording takes no locks and allocates nothing.
+ When a ring buffer is full, the oldest records of that thread are overwritten.
+
+ Records are exported with `chromeTrace()` into the Chrome trace event format, which can be opened in
+ Perfetto or `chrome://tracing`. Every subscription is exported as an async slice from subscription to disposal,
+ with its events as instants inside the slice.
+
+ Records are written without synchronization with readers, so `chromeTrace()` and `clear()` should be
+ called after tracing is disabled and traced sequences are quiescent. Exporting while recording still works,
+ but records that are being overwritten at that moment can come out garbled.
+ */
+public enum Tracing {
+    /// Enables tracing for subscriptions made from now on.
+    public static var isEnabled: Bool {
+        get {
+            isFlagSet(enabled, 1)
+        }
+        set {
+            lock.performLocked {
+                _ = newValue ? fetchOr(enabled, 1) : sub(enabled, load(enabled))
+            }
+        }
+    }
+
+    /// Number of records kept per thread, rounded up to a power of two.
+    ///
+    /// Applies to threads that record for the first time after it's set. Every record takes 32 bytes.
+    public static var recordsPerThread: Int {
+        get {
+            lock.performLocked { _recordsPerThread }
+        }
+        set {
+            lock.performLocked { _recordsPerThread = newValue }
+        }
+    }
+
+    /**
+     Exports all records as Chrome trace event format JSON.
+
+     - returns: UTF-8 encoded JSON object with a `traceEvents` array.
+     */
+    public static func chromeTrace() -> Data {
+        let (buffers, streamNames) = lock.performLocked { (self.buffers, self.streamNames) }
+
+        var events = [(timestamp: UInt64, order: Int, event: [String: Any])]()
+        for buffer in buffers {
+            for record in buffer.records() {
+                events.append((record.timestamp, events.count, chromeTraceEvent(record, threadId: buffer.threadId, streamNames: streamNames)))
+            }
+        }
+        // Records of a thread are already ordered, keep that order when timestamps are equal.
+        events.sort { ($0.timestamp, $0.order) < ($1.timestamp, $1.order) }
+
+        let trace: [String: Any] = [
+            "traceEvents": events.map(\.event),
+            "displayTimeUnit": "ns"
+        ]
+
+        do {
+            return try JSONSerialization.data(withJSONObject: trace, options: [])
+        } catch {
+            rxFatalError("Trace serialization failed: \(error)")
+        }
+    }
+
+    /// Removes all records.
+    public static func clear() {
+        lock.performLocked {
+            for buffer in self.buffers {
+                buffer.clear()
+            }
+        }
+    }
+
+    /// Id of the stream named `name`.
+    static func stream(named name: String) -> UInt32 {
+        lock.performLocked {
+            if let stream = self.streamIds[name] {
+                return stream
+            }
+            let stream = UInt32(self.streamNames.count)
+            self.streamNames.append(name)
+            self.streamIds[name] = stream
+            return stream
+        }
+    }
+
+    static func nextSubscriptionId() -> UInt32 {
+        UInt32(bitPattern: increment(subscriptionIds))
+    }
+
+    @inline(__always)
+    static func record(_ kind: TraceEventKind, stream: UInt32, subscription: UInt32, elementHash: Int? = nil) {
+        currentBuffer.append(TraceRecord(
+            timestamp: DispatchTime.now().uptimeNanoseconds,
+            elementHash: elementHash ?? 0,
+            stream: stream,
+            subscription: subscription,
+            kind: kind,
+            hasElementHash: elementHash != nil
+        ))
+    }
+
+    /// Buffers of threads that exited are kept for export, but only this many of them.
+    private static let maxRetiredBuffers = 64
+
+    private static let lock = SpinLock()
+    // Read on every subscription, so it's an atomic load instead of taking `lock`.
+    private static let enabled = AtomicInt(0)
+    private static var _recordsPerThread = 1 << 16
+    private static let subscriptionIds = AtomicInt(0)
+
+    // state
+    private static var buffers = [TraceBuffer]()
+    private static var streamNames = [String]()
+    private static var streamIds = [String: UInt32]()
+    private static var nextThreadId = 1
+
+    private static let bufferKey: pthread_key_t = { () -> pthread_key_t in
+        let key = UnsafeMutablePointer<pthread_key_t>.allocate(capacity: 1)
+        defer { key.deallocate() }
+
+        #if canImport(Darwin)
+        let destructor: @convention(c) (UnsafeMutableRawPointer) -> Void = { buffer in
+            Tracing.retire(Unmanaged<TraceBuffer>.fromOpaque(buffer).takeUnretainedValue())
+        }
+        #else
+        let destructor: @convention(c) (UnsafeMutableRawPointer?) -> Void = { buffer in
+            guard let buffer else { return }
+            Tracing.retire(Unmanaged<TraceBuffer>.fromOpaque(buffer).takeUnretainedValue())
+        }
+        #endif
+
+        guard pthread_key_create(key, destructor) == 0 else {
+            rxFatalError("Tracing buffer key creation failed")
+        }
+
+        return key.pointee
+    }()
+
+    private static var currentBuffer: TraceBuffer {
+        if let buffer = pthread_getspecific(bufferKey) {
+            return Unmanaged<TraceBuffer>.fromOpaque(buffer).takeUnretainedValue()
+        }
+
+        // The registry owns buffers, the thread only borrows its own one until it exits.
+        let buffer = lock.performLocked { () -> TraceBuffer in
+            let buffer = TraceBuffer(threadId: self.nextThreadId, capacity: self._recordsPerThread)
+            self.nextThreadId += 1
+            self.buffers.append(buffer)
+            return buffer
+        }
+
+        if pthread_setspecific(bufferKey, Unmanaged.passUnretained(buffer).toOpaque()) != 0 {
+            rxFatalError("pthread_setspecific failed")
+        }
+
+        return buffer
+    }
+
+    private static func retire(_ buffer: TraceBuffer) {
+        lock.performLocked {
+            buffer.isRetired = true
+
+            let retired = self.buffers.filter(\.isRetired)
+            if retired.count > maxRetiredBuffers {
+                let dropped = ObjectIdentifier(retired[0])
+                self.buffers.removeAll { ObjectIdentifier($0) == dropped }
+            }
+        }
+    }
+
+    private static func chromeTraceEvent(_ record: TraceRecord, threadId: Int, streamNames: [String]) -> [String: Any] {
+        let streamName = Int(record.stream) < streamNames.count ? streamNames[Int(record.stream)] : "\(record.stream)"
+
+        var event: [String: Any] = [
+            "cat": "rx",
+            "id": Int(record.subscription),
+            "pid": 1,
+            "tid": threadId,
+            "ts": Double(record.timestamp) / 1000
+        ]
+
+        switch record.kind {
+        case .subscribe:
+            event["ph"] = "b"
+            event["name"] = streamName
+        case .dispose:
+            event["ph"] = "e"
+            event["name"] = streamName
+        case .next:
+            event["ph"] = "n"
+            event["name"] = "next"
+        case .error:
+            event["ph"] = "n"
+            event["name"] = "error"
+        case .completed:
+            event["ph"] = "n"
+            event["name"] = "completed"
+        }
+
+        if record.hasElementHash {
+            event["args"] = ["hash": record.elementHash]
+        }
+
+        return event
+    }
+}
+
+enum TraceEventKind: UInt8 {
+    case subscribe
+    case next
+    case error
+    case completed
+    case dispose
+}
+
+/// Fixed-size trace record, 32 bytes on 64-bit platforms. Thread id is stored once per buffer.
+struct TraceRecord {
+    var timestamp: UInt64
+    var elementHash: Int
+    var stream: UInt32
+    var subscription: UInt32
+    var kind: TraceEventKind
+    var hasElementHash: Bool
+}
+
+/// Ring buffer of a single thread.
+private final class TraceBuffer {
+    let threadId: Int
+
+    private let mask: Int
+    private let storage: UnsafeMutablePointer<TraceRecord>
+
+    // written only by the owning thread
+    private var written = 0
+
+    // guarded by the registry lock
+    var isRetired = false
+
+    init(threadId: Int, capacity: Int) {
+        var size = 1
+        while size < capacity {
+            size <<= 1
+        }
+
+        self.threadId = threadId
+        mask = size - 1
+        storage = UnsafeMutablePointer<TraceRecord>.allocate(capacity: size)
+        storage.initialize(
+            repeating: TraceRecord(timestamp: 0, elementHash: 0, stream: 0, subscription: 0, kind: .next, hasElementHash: false),
+            count: size
+        )
+    }
+
+    @inline(__always)
+    func append(_ record: TraceRecord) {
+        storage[written & mask] = record
+        written &+= 1
+    }
+
+    /// Records in the order they were written.
+    func records() -> [TraceRecord] {
+        let written = written
+        let count = Swift.min(written, mask + 1)
+        return (written - count ..< written).map { storage[$0 & mask] }
+    }
+
+    func clear() {
+        written = 0
+    }
+
+    deinit {
+        storage.deinitialize(count: mask + 1)
+        storage.deallocate()
+    }
+}
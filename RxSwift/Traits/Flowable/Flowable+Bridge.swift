@@ -0,0 +1,266 @@
+//
+//  Flowable+Bridge.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+
+/// Strategy used when an `Observable` produces elements faster than a `Flowable` subscriber requests them.
+public enum BackpressureStrategy {
+    /// Buffers up to `size` elements that weren't requested yet and applies `overflow` when the buffer is full.
+    case buffer(size: Int, overflow: BufferOverflowStrategy)
+    /// Drops elements that weren't requested.
+    case drop
+    /// Keeps only the latest element that wasn't requested.
+    case latest
+}
+
+public extension ObservableType {
+    /**
+     Converts an observable sequence to a `Flowable`.
+
+     Elements are delivered as they are requested. Elements produced while there is no outstanding demand are
+     handled by `strategy`. Completion is delivered after the buffered elements, errors are delivered immediately.
+
+     - parameter strategy: Strategy for elements that were produced but not requested yet.
+     - returns: Flowable that emits elements of `self`.
+     */
+    func toFlowable(_ strategy: BackpressureStrategy) -> Flowable<Element> {
+        ObservableToFlowable(source: asObservable(), strategy: strategy)
+    }
+}
+
+private final class ObservableToFlowable<Element>: Flowable<Element> {
+    fileprivate let source: Observable<Element>
+    fileprivate let bufferSize: Int
+    fileprivate let overflow: BufferOverflowStrategy
+
+    init(source: Observable<Element>, strategy: BackpressureStrategy) {
+        self.source = source
+
+        switch strategy {
+        case let .buffer(size, overflow):
+            guard size > 0 else {
+                rxFatalError("buffer size must be positive")
+            }
+            bufferSize = size
+            self.overflow = overflow
+        case .drop:
+            bufferSize = 0
+            overflow = .dropNewest
+        case .latest:
+            bufferSize = 1
+            overflow = .dropOldest
+        }
+    }
+
+    override func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        let subscription = ObservableToFlowableSubscription(parent: self, subscriber: subscriber)
+        subscriber.onSubscribe(subscription)
+        subscription.run()
+    }
+}
+
+private final class ObservableToFlowableSubscription<Subscriber: FlowSubscriberType>: FlowSubscription, ObserverType {
+    typealias Element = Subscriber.Element
+    typealias Parent = ObservableToFlowable<Element>
+
+    private enum EnqueueResult {
+        case done
+        case overflowed
+        case mustWait
+    }
+
+    private let parent: Parent
+    private let subscriber: Subscriber
+
+    private let lock = SpinLock()
+    private let upstream = SingleAssignmentDisposable()
+    private let producerUnblocked = DispatchSemaphore(value: 0)
+
+    // state
+    private var requested = 0
+    private var queue = Queue<Element>(capacity: 4)
+    private var terminalEvent: Event<Element>?
+    private var isDraining = false
+    private var isProducerBlocked = false
+    private var isDisposed = false
+
+    init(parent: Parent, subscriber: Subscriber) {
+        self.parent = parent
+        self.subscriber = subscriber
+    }
+
+    func run() {
+        upstream.setDisposable(parent.source.subscribe(self))
+    }
+
+    func request(_ count: Int) {
+        guard isValidFlowRequest(count) else {
+            return
+        }
+
+        lock.performLocked {
+            self.requested = flowDemand(self.requested, adding: count)
+            self.synchronized_unblockProducer()
+        }
+
+        drain()
+    }
+
+    func on(_ event: Event<Element>) {
+        switch event {
+        case let .next(element):
+            if enqueue(element) == .overflowed {
+                upstream.dispose()
+            }
+        case .error, .completed:
+            lock.performLocked {
+                if self.terminalEvent == nil {
+                    self.terminalEvent = event
+                }
+            }
+        }
+
+        drain()
+    }
+
+    private func enqueue(_ element: Element) -> EnqueueResult {
+        while true {
+            let result = lock.performLocked { () -> EnqueueResult in
+                if self.isDisposed || self.terminalEvent != nil {
+                    return .done
+                }
+
+                if self.queue.count < flowDemand(self.requested, adding: self.parent.bufferSize) {
+                    self.queue.enqueue(element)
+                    return .done
+                }
+
+                switch self.parent.overflow {
+                case .dropOldest:
+                    if self.queue.dequeue() != nil {
+                        self.queue.enqueue(element)
+                    }
+                    return .done
+                case .dropNewest:
+                    return .done
+                case .error:
+                    self.terminalEvent = .error(RxError.bufferOverflow)
+                    return .overflowed
+                case .block:
+                    self.isProducerBlocked = true
+                    return .mustWait
+                }
+            }
+
+            if result != .mustWait {
+                return result
+            }
+
+            producerUnblocked.wait()
+        }
+    }
+
+    private func drain() {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            if self.isDraining {
+                return false
+            }
+            self.isDraining = true
+            return true
+        }
+
+        guard shouldDrain else {
+            return
+        }
+
+        while let event = lock.performLocked({ self.synchronized_nextEvent() }) {
+            subscriber.on(event)
+            if event.isStopEvent {
+                dispose()
+                return
+            }
+        }
+    }
+
+    /// Returns the next event to deliver, or clears `isDraining` if there is nothing to deliver.
+    private func synchronized_nextEvent() -> Event<Element>? {
+        if !isDisposed {
+            if case .error? = terminalEvent {
+                return terminalEvent
+            }
+
+            if requested > 0, let element = queue.dequeue() {
+                requested = flowDemand(requested, removing: 1)
+                synchronized_unblockProducer()
+                return .next(element)
+            }
+
+            if queue.isEmpty, let terminalEvent {
+                return terminalEvent
+            }
+        }
+
+        isDraining = false
+        return nil
+    }
+
+    private func synchronized_unblockProducer() {
+        if isProducerBlocked {
+            isProducerBlocked = false
+            producerUnblocked.signal()
+        }
+    }
+
+    func dispose() {
+        let shouldDispose = lock.performLocked { () -> Bool in
+            if self.isDisposed {
+                return false
+            }
+            self.isDisposed = true
+            self.queue = Queue(capacity: 0)
+            self.synchronized_unblockProducer()
+            return true
+        }
+
+        if shouldDispose {
+            upstream.dispose()
+        }
+    }
+}
+
+private final class FlowableAsObservable<Element>: Producer<Element> {
+    private let source: Flowable<Element>
+
+    init(source: Flowable<Element>) {
+        self.source = source
+    }
+
+    override func run<Observer: ObserverType>(_ observer: Observer, cancel: Cancelable) -> (sink: Disposable, subscription: Disposable) where Observer.Element == Element {
+        let sink = FlowableAsObservableSink(observer: observer, cancel: cancel)
+        source.subscribe(sink)
+        return (sink: sink, subscription: sink.subscription)
+    }
+}
+
+private final class FlowableAsObservableSink<Observer: ObserverType>: Sink<Observer>, FlowSubscriberType {
+    typealias Element = Observer.Element
+
+    let subscription = SingleAssignmentDisposable()
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        self.subscription.setDisposable(subscription)
+        subscription.request(Int.max)
+    }
+
+    func on(_ event: Event<Element>) {
+        forwardOn(event)
+        if event.isStopEvent {
+            dispose()
+        }
+    }
+}
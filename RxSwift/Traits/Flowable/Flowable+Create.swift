@@ -0,0 +1,134 @@
+//
+//  Flowable+Create.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+public extension Flowable {
+    /**
+     Converts a sequence to a flowable sequence.
+
+     Elements are pulled from the sequence only as they are requested.
+
+     - parameter sequence: Sequence to pull elements from.
+     - returns: The flowable sequence whose elements are pulled from the given sequence.
+     */
+    static func from<Sequence: Swift.Sequence>(_ sequence: Sequence) -> Flowable<Element> where Sequence.Element == Element {
+        FlowableSequence(elements: sequence)
+    }
+}
+
+private final class FlowableSequence<Sequence: Swift.Sequence>: Flowable<Sequence.Element> {
+    fileprivate let elements: Sequence
+
+    init(elements: Sequence) {
+        self.elements = elements
+    }
+
+    override func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        let subscription = FlowableSequenceSubscription(iterator: elements.makeIterator(), subscriber: subscriber)
+        subscriber.onSubscribe(subscription)
+        subscription.drain()
+    }
+}
+
+private final class FlowableSequenceSubscription<Iterator: IteratorProtocol, Subscriber: FlowSubscriberType>: FlowSubscription where Iterator.Element == Subscriber.Element {
+    private let subscriber: Subscriber
+
+    private let lock = SpinLock()
+
+    // state
+    private var requested = 0
+    private var isDraining = false
+    private var isDisposed = false
+
+    // only touched by the drain
+    private var iterator: Iterator
+    private var pending: Iterator.Element?
+
+    init(iterator: Iterator, subscriber: Subscriber) {
+        self.iterator = iterator
+        self.subscriber = subscriber
+    }
+
+    func request(_ count: Int) {
+        guard isValidFlowRequest(count) else {
+            return
+        }
+
+        lock.performLocked {
+            self.requested = flowDemand(self.requested, adding: count)
+        }
+
+        drain()
+    }
+
+    func drain() {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            if self.isDraining || self.isDisposed {
+                return false
+            }
+            self.isDraining = true
+            return true
+        }
+
+        guard shouldDrain else {
+            return
+        }
+
+        while true {
+            // `nil` means the subscription was disposed
+            let hasDemand = lock.performLocked { () -> Bool? in
+                if self.isDisposed {
+                    return nil
+                }
+                if self.requested > 0 {
+                    self.requested = flowDemand(self.requested, removing: 1)
+                    return true
+                }
+                return false
+            }
+
+            guard let hasDemand else {
+                return
+            }
+
+            // The next element is pulled ahead of demand so completion doesn't wait for a request.
+            if pending == nil {
+                pending = iterator.next()
+            }
+
+            guard let element = pending else {
+                subscriber.on(.completed)
+                dispose()
+                return
+            }
+
+            if hasDemand {
+                pending = nil
+                subscriber.on(.next(element))
+                continue
+            }
+
+            let shouldStop = lock.performLocked { () -> Bool in
+                if self.requested > 0 {
+                    return false
+                }
+                self.isDraining = false
+                return true
+            }
+
+            if shouldStop {
+                return
+            }
+        }
+    }
+
+    func dispose() {
+        lock.performLocked {
+            self.isDisposed = true
+        }
+    }
+}
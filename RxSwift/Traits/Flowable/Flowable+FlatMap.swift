@@ -0,0 +1,320 @@
+//
+//  Flowable+FlatMap.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/// Number of elements requested from each inner flowable ahead of delivery.
+private let flatMapInnerPrefetch = 32
+
+public extension Flowable {
+    /**
+     Projects each element of a flowable sequence to a flowable sequence and merges the resulting flowable sequences.
+
+     At most `maxConcurrency` inner sequences are subscribed at the same time, and each of them is asked for at most
+     a fixed number of elements ahead of downstream demand, so memory stays bounded regardless of how slow
+     the subscriber is. Elements of concurrently active inner sequences are delivered in a round-robin fashion.
+
+     - seealso: [flatMap operator on reactivex.io](http://reactivex.io/documentation/operators/flatmap.html)
+
+     - parameter maxConcurrency: Maximum number of inner sequences subscribed at the same time.
+     - parameter selector: A transform function to apply to each element.
+     - returns: A flowable sequence whose elements are the result of invoking the one-to-many transform function on each element of the input sequence.
+     */
+    func flatMap<Result>(maxConcurrency: Int, _ selector: @escaping (Element) throws -> Flowable<Result>) -> Flowable<Result> {
+        FlowableFlatMap(source: self, maxConcurrency: maxConcurrency, selector: selector)
+    }
+}
+
+private final class FlowableFlatMap<SourceElement, Element>: Flowable<Element> {
+    typealias Selector = (SourceElement) throws -> Flowable<Element>
+
+    fileprivate let source: Flowable<SourceElement>
+    fileprivate let maxConcurrency: Int
+    fileprivate let selector: Selector
+
+    init(source: Flowable<SourceElement>, maxConcurrency: Int, selector: @escaping Selector) {
+        guard maxConcurrency > 0 else {
+            rxFatalError("maxConcurrency must be positive")
+        }
+
+        self.source = source
+        self.maxConcurrency = maxConcurrency
+        self.selector = selector
+    }
+
+    override func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        source.subscribe(FlowableFlatMapSubscriber(parent: self, subscriber: subscriber))
+    }
+}
+
+private final class FlowableFlatMapInner<SourceElement, Subscriber: FlowSubscriberType>: FlowSubscriberType {
+    typealias Element = Subscriber.Element
+    typealias Parent = FlowableFlatMapSubscriber<SourceElement, Subscriber>
+
+    private let parent: Parent
+
+    // state, guarded by `parent.lock`
+    var queue = Queue<Element>(capacity: 4)
+    var upstream: FlowSubscription?
+    var isDone = false
+    var consumed = 0
+
+    init(parent: Parent) {
+        self.parent = parent
+    }
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        parent.inner(self, didSubscribe: subscription)
+    }
+
+    func on(_ event: Event<Element>) {
+        parent.inner(self, on: event)
+    }
+}
+
+private final class FlowableFlatMapSubscriber<SourceElement, Subscriber: FlowSubscriberType>: FlowSubscriberType, FlowSubscription {
+    typealias Element = SourceElement
+    typealias Parent = FlowableFlatMap<SourceElement, Subscriber.Element>
+    typealias Inner = FlowableFlatMapInner<SourceElement, Subscriber>
+
+    private enum Action {
+        case next(Subscriber.Element, replenish: (subscription: FlowSubscription, count: Int)?)
+        case requestOuter(Int)
+        case error(Swift.Error, cancel: [FlowSubscription])
+        case completed
+    }
+
+    private let parent: Parent
+    private let subscriber: Subscriber
+    private let replenishLimit = flatMapInnerPrefetch - flatMapInnerPrefetch / 4
+
+    let lock = SpinLock()
+    private var outer: FlowSubscription?
+
+    // state
+    private var inners: [Inner] = []
+    private var cursor = 0
+    private var requested = 0
+    private var pendingOuterRequests = 0
+    private var isOuterDone = false
+    private var error: Swift.Error?
+    private var isDraining = false
+    private var isDisposed = false
+
+    init(parent: Parent, subscriber: Subscriber) {
+        self.parent = parent
+        self.subscriber = subscriber
+    }
+
+    // MARK: outer
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        outer = subscription
+        subscriber.onSubscribe(self)
+        subscription.request(parent.maxConcurrency)
+    }
+
+    func on(_ event: Event<SourceElement>) {
+        switch event {
+        case let .next(element):
+            let source: Flowable<Subscriber.Element>
+            do {
+                source = try parent.selector(element)
+            } catch let e {
+                lock.performLocked { self.synchronized_fail(e) }
+                drain()
+                return
+            }
+
+            let inner = Inner(parent: self)
+            let isDisposed = lock.performLocked { () -> Bool in
+                if !self.isDisposed {
+                    self.inners.append(inner)
+                }
+                return self.isDisposed
+            }
+            if !isDisposed {
+                source.subscribe(inner)
+            }
+        case let .error(error):
+            lock.performLocked { self.synchronized_fail(error) }
+            drain()
+        case .completed:
+            lock.performLocked { self.isOuterDone = true }
+            drain()
+        }
+    }
+
+    // MARK: inner
+
+    func inner(_ inner: Inner, didSubscribe subscription: FlowSubscription) {
+        let isDisposed = lock.performLocked { () -> Bool in
+            inner.upstream = subscription
+            return self.isDisposed
+        }
+
+        if isDisposed {
+            subscription.dispose()
+        } else {
+            subscription.request(flatMapInnerPrefetch)
+        }
+    }
+
+    func inner(_ inner: Inner, on event: Event<Subscriber.Element>) {
+        lock.performLocked {
+            switch event {
+            case let .next(element):
+                inner.queue.enqueue(element)
+            case let .error(error):
+                self.synchronized_fail(error)
+            case .completed:
+                inner.isDone = true
+                self.synchronized_removeIfFinished(inner)
+            }
+        }
+
+        drain()
+    }
+
+    // MARK: downstream
+
+    func request(_ count: Int) {
+        guard isValidFlowRequest(count) else {
+            return
+        }
+
+        lock.performLocked {
+            self.requested = flowDemand(self.requested, adding: count)
+        }
+
+        drain()
+    }
+
+    func dispose() {
+        let subscriptions = lock.performLocked { () -> [FlowSubscription] in
+            if self.isDisposed {
+                return []
+            }
+            self.isDisposed = true
+            return self.synchronized_removeAllInners()
+        }
+
+        outer?.dispose()
+        for subscription in subscriptions {
+            subscription.dispose()
+        }
+    }
+
+    // MARK: drain
+
+    private func drain() {
+        let shouldDrain = lock.performLocked { () -> Bool in
+            if self.isDraining {
+                return false
+            }
+            self.isDraining = true
+            return true
+        }
+
+        guard shouldDrain else {
+            return
+        }
+
+        while let action = lock.performLocked({ self.synchronized_nextAction() }) {
+            switch action {
+            case let .next(element, replenish):
+                subscriber.on(.next(element))
+                if let replenish {
+                    replenish.subscription.request(replenish.count)
+                }
+            case let .requestOuter(count):
+                outer?.request(count)
+            case let .error(error, cancel):
+                outer?.dispose()
+                for subscription in cancel {
+                    subscription.dispose()
+                }
+                subscriber.on(.error(error))
+                return
+            case .completed:
+                subscriber.on(.completed)
+                return
+            }
+        }
+    }
+
+    /// Returns the next action to perform outside of the lock, or clears `isDraining` if there is nothing to do.
+    ///
+    /// After a terminal action `isDisposed` is set and `isDraining` stays set, so nothing is delivered afterwards.
+    private func synchronized_nextAction() -> Action? {
+        if isDisposed {
+            return nil
+        }
+
+        if let error {
+            isDisposed = true
+            return .error(error, cancel: synchronized_removeAllInners())
+        }
+
+        if pendingOuterRequests > 0, !isOuterDone {
+            defer { pendingOuterRequests = 0 }
+            return .requestOuter(pendingOuterRequests)
+        }
+
+        if requested > 0, !inners.isEmpty {
+            for offset in 0 ..< inners.count {
+                let index = (cursor + offset) % inners.count
+                let inner = inners[index]
+                guard let element = inner.queue.dequeue() else {
+                    continue
+                }
+
+                cursor = index + 1
+                requested = flowDemand(requested, removing: 1)
+                inner.consumed += 1
+
+                var replenish: (subscription: FlowSubscription, count: Int)?
+                if inner.consumed >= replenishLimit, !inner.isDone, let upstream = inner.upstream {
+                    replenish = (upstream, inner.consumed)
+                    inner.consumed = 0
+                }
+
+                synchronized_removeIfFinished(inner)
+
+                return .next(element, replenish: replenish)
+            }
+        }
+
+        if isOuterDone, inners.isEmpty {
+            isDisposed = true
+            return .completed
+        }
+
+        isDraining = false
+        return nil
+    }
+
+    private func synchronized_fail(_ error: Swift.Error) {
+        if self.error == nil {
+            self.error = error
+        }
+    }
+
+    private func synchronized_removeIfFinished(_ inner: Inner) {
+        guard inner.isDone, inner.queue.isEmpty, let index = inners.firstIndex(where: { $0 === inner }) else {
+            return
+        }
+
+        inners.remove(at: index)
+        pendingOuterRequests += 1
+    }
+
+    private func synchronized_removeAllInners() -> [FlowSubscription] {
+        let subscriptions = inners.compactMap(\.upstream)
+        inners = []
+        return subscriptions
+    }
+}
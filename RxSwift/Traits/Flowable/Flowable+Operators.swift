@@ -0,0 +1,330 @@
+//
+//  Flowable+Operators.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+// MARK: map, filter, compactMap
+
+public extension Flowable {
+    /**
+     Projects each element of a flowable sequence into a new form.
+
+     Demand is passed upstream unchanged.
+
+     - seealso: [map operator on reactivex.io](http://reactivex.io/documentation/operators/map.html)
+
+     - parameter transform: A transform function to apply to each source element.
+     - returns: A flowable sequence whose elements are the result of invoking the transform function on each element of source.
+     */
+    func map<Result>(_ transform: @escaping (Element) throws -> Result) -> Flowable<Result> {
+        FlowableCompactMap(source: self) { try transform($0) }
+    }
+
+    /**
+     Filters the elements of a flowable sequence based on a predicate.
+
+     Each element that doesn't satisfy the predicate is replaced by requesting one more element from upstream.
+
+     - seealso: [filter operator on reactivex.io](http://reactivex.io/documentation/operators/filter.html)
+
+     - parameter predicate: A function to test each source element for a condition.
+     - returns: A flowable sequence that contains elements from the input sequence that satisfy the condition.
+     */
+    func filter(_ predicate: @escaping (Element) throws -> Bool) -> Flowable<Element> {
+        FlowableCompactMap(source: self) { try predicate($0) ? $0 : nil }
+    }
+
+    /**
+     Projects each element of a flowable sequence into an optional form and filters all optional results.
+
+     Each `nil` result is replaced by requesting one more element from upstream.
+
+     - parameter transform: A transform function to apply to each source element and which returns an element or nil.
+     - returns: A flowable sequence whose elements are the result of filtering the transform function for each element of the source.
+     */
+    func compactMap<Result>(_ transform: @escaping (Element) throws -> Result?) -> Flowable<Result> {
+        FlowableCompactMap(source: self, transform: transform)
+    }
+}
+
+private final class FlowableCompactMap<SourceElement, Element>: Flowable<Element> {
+    private let source: Flowable<SourceElement>
+    private let transform: ElementStage<SourceElement, Element>
+
+    init(source: Flowable<SourceElement>, transform: @escaping ElementStage<SourceElement, Element>) {
+        self.source = source
+        self.transform = transform
+    }
+
+    override func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        source.subscribe(FlowableCompactMapSubscriber(transform: transform, subscriber: subscriber))
+    }
+}
+
+private final class FlowableCompactMapSubscriber<SourceElement, Subscriber: FlowSubscriberType>: FlowSubscriberType {
+    typealias Element = SourceElement
+
+    private let transform: ElementStage<SourceElement, Subscriber.Element>
+    private let subscriber: Subscriber
+
+    private var upstream: FlowSubscription?
+    private var isStopped = false
+
+    init(transform: @escaping ElementStage<SourceElement, Subscriber.Element>, subscriber: Subscriber) {
+        self.transform = transform
+        self.subscriber = subscriber
+    }
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        upstream = subscription
+        subscriber.onSubscribe(subscription)
+    }
+
+    func on(_ event: Event<SourceElement>) {
+        if isStopped {
+            return
+        }
+
+        switch event {
+        case let .next(element):
+            do {
+                if let result = try transform(element) {
+                    subscriber.on(.next(result))
+                } else {
+                    upstream?.request(1)
+                }
+            } catch let e {
+                isStopped = true
+                upstream?.dispose()
+                subscriber.on(.error(e))
+            }
+        case let .error(error):
+            isStopped = true
+            subscriber.on(.error(error))
+        case .completed:
+            isStopped = true
+            subscriber.on(.completed)
+        }
+    }
+}
+
+// MARK: observe(on:)
+
+public extension Flowable {
+    /**
+     Wraps the source sequence in order to run its subscriber callbacks on the specified scheduler.
+
+     At most `bufferSize` elements are requested from upstream ahead of delivery. Delivered elements are replenished
+     in batches, so a slow subscriber slows down the upstream instead of growing a queue.
+
+     - seealso: [observeOn operator on reactivex.io](http://reactivex.io/documentation/operators/observeon.html)
+
+     - parameter scheduler: Scheduler to notify subscribers on.
+     - parameter bufferSize: Maximum number of elements requested from upstream but not yet delivered.
+     - returns: The source sequence whose observations happen on the specified scheduler.
+     */
+    func observe(on scheduler: ImmediateSchedulerType, bufferSize: Int = 128) -> Flowable<Element> {
+        FlowableObserveOn(source: self, scheduler: scheduler, bufferSize: bufferSize)
+    }
+}
+
+private final class FlowableObserveOn<Element>: Flowable<Element> {
+    fileprivate let source: Flowable<Element>
+    fileprivate let scheduler: ImmediateSchedulerType
+    fileprivate let bufferSize: Int
+
+    init(source: Flowable<Element>, scheduler: ImmediateSchedulerType, bufferSize: Int) {
+        guard bufferSize > 0 else {
+            rxFatalError("bufferSize must be positive")
+        }
+
+        self.source = source
+        self.scheduler = scheduler
+        self.bufferSize = bufferSize
+    }
+
+    override func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        source.subscribe(FlowableObserveOnSubscriber(parent: self, subscriber: subscriber))
+    }
+}
+
+private final class FlowableObserveOnSubscriber<Subscriber: FlowSubscriberType>: FlowSubscriberType, FlowSubscription {
+    typealias Element = Subscriber.Element
+    typealias Parent = FlowableObserveOn<Element>
+
+    private let scheduler: ImmediateSchedulerType
+    private let subscriber: Subscriber
+    private let bufferSize: Int
+    private let replenishLimit: Int
+
+    private let lock = SpinLock()
+    private let scheduleDisposable = SerialDisposable()
+    private var upstream: FlowSubscription?
+
+    // state
+    private var state = ObserveOnState.stopped
+    private var buffer: RingBuffer<Element>
+    private var terminalEvent: Event<Element>?
+    private var requested = 0
+    private var isDisposed = false
+
+    // only touched by `run`
+    private var consumed = 0
+
+    init(parent: Parent, subscriber: Subscriber) {
+        scheduler = parent.scheduler
+        self.subscriber = subscriber
+        bufferSize = parent.bufferSize
+        replenishLimit = Swift.max(1, parent.bufferSize - parent.bufferSize / 4)
+        buffer = RingBuffer(capacity: parent.bufferSize)
+    }
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        upstream = subscription
+        subscriber.onSubscribe(self)
+        subscription.request(bufferSize)
+    }
+
+    func on(_ event: Event<Element>) {
+        lock.performLocked {
+            if self.terminalEvent != nil {
+                return
+            }
+
+            switch event {
+            case let .next(element):
+                if !self.buffer.enqueue(element) {
+                    self.terminalEvent = .error(RxError.bufferOverflow)
+                }
+            case .error, .completed:
+                self.terminalEvent = event
+            }
+        }
+
+        schedule()
+    }
+
+    func request(_ count: Int) {
+        guard isValidFlowRequest(count) else {
+            return
+        }
+
+        lock.performLocked {
+            self.requested = flowDemand(self.requested, adding: count)
+        }
+
+        schedule()
+    }
+
+    private func schedule() {
+        let shouldStart = lock.performLocked { () -> Bool in
+            if self.isDisposed {
+                return false
+            }
+
+            switch self.state {
+            case .stopped:
+                self.state = .running
+                return true
+            case .running:
+                return false
+            }
+        }
+
+        if shouldStart {
+            scheduleDisposable.disposable = scheduler.scheduleRecursive((), action: run)
+        }
+    }
+
+    func run(_: (), _ recurse: (()) -> Void) {
+        var delivered = 0
+
+        while delivered < bufferSize {
+            var event = lock.performLocked { self.synchronized_nextEvent() }
+
+            if event == nil {
+                // Replenish before releasing `.running`, so a run started by `schedule` can't touch `consumed`
+                // and `upstream` at the same time.
+                replenish(delivered)
+                delivered = 0
+                event = lock.performLocked { self.synchronized_nextEventOrStop() }
+            }
+
+            guard let event else {
+                return
+            }
+
+            subscriber.on(event)
+
+            if event.isStopEvent {
+                dispose()
+                return
+            }
+
+            delivered += 1
+        }
+
+        replenish(delivered)
+        recurse(())
+    }
+
+    /// Returns the next event to deliver, `nil` if there is nothing to deliver.
+    private func synchronized_nextEvent() -> Event<Element>? {
+        if isDisposed {
+            return nil
+        }
+
+        if case .error? = terminalEvent {
+            return terminalEvent
+        }
+
+        if requested > 0, let element = buffer.dequeue() {
+            requested = flowDemand(requested, removing: 1)
+            return .next(element)
+        }
+
+        if buffer.isEmpty, let terminalEvent {
+            return terminalEvent
+        }
+
+        return nil
+    }
+
+    /// Returns the next event to deliver, or stops the drain if there is nothing to deliver.
+    private func synchronized_nextEventOrStop() -> Event<Element>? {
+        if let event = synchronized_nextEvent() {
+            return event
+        }
+
+        state = .stopped
+        return nil
+    }
+
+    private func replenish(_ delivered: Int) {
+        consumed += delivered
+        if consumed >= replenishLimit {
+            let count = consumed
+            consumed = 0
+            upstream?.request(count)
+        }
+    }
+
+    func dispose() {
+        let shouldDispose = lock.performLocked { () -> Bool in
+            if self.isDisposed {
+                return false
+            }
+            self.isDisposed = true
+            self.buffer.removeAll()
+            return true
+        }
+
+        if shouldDispose {
+            upstream?.dispose()
+            scheduleDisposable.dispose()
+        }
+    }
+}
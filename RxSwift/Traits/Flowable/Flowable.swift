@@ -0,0 +1,94 @@
+//
+//  Flowable.swift
+//  RxSwift
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+/// Handle a `Flowable` subscriber uses to signal demand and to cancel the subscription.
+public protocol FlowSubscription: Disposable {
+    /// Requests `count` more elements.
+    ///
+    /// Requests accumulate. Requesting `Int.max` elements means unbounded demand.
+    ///
+    /// - parameter count: Number of additional elements the subscriber can handle. Must be positive.
+    func request(_ count: Int)
+}
+
+/// Receives events from a `Flowable`.
+public protocol FlowSubscriberType {
+    /// The type of elements in sequence that subscriber can observe.
+    associatedtype Element
+
+    /// Called exactly once, before any other event, with the subscription used to request elements.
+    ///
+    /// - parameter subscription: Subscription used to request elements and to cancel.
+    func onSubscribe(_ subscription: FlowSubscription)
+
+    /// Notify subscriber about sequence event.
+    ///
+    /// A `Flowable` never sends more `next` events than were requested. Termination events don't require demand.
+    ///
+    /// - parameter event: Event that occurred.
+    func on(_ event: Event<Element>)
+}
+
+/**
+ `Flowable` is a demand driven sequence: elements only flow after the subscriber requested them
+ with `FlowSubscription.request(_:)`, in the spirit of Reactive Streams.
+
+ A slow consumer therefore slows down the whole chain instead of making intermediate operators buffer without bound.
+ Use `ObservableType.toFlowable(_:)` to decide explicitly what happens to elements an `Observable` produces
+ faster than they are requested, and `asObservable()` to get back to an `Observable` that requests everything.
+ */
+public class Flowable<Element>: ObservableConvertibleType {
+    init() {
+        #if TRACE_RESOURCES
+        _ = Resources.incrementTotal()
+        #endif
+    }
+
+    /**
+     Subscribes `subscriber` to receive events for this sequence.
+
+     `subscriber.onSubscribe` is called first, and no elements are sent until the subscriber requests them.
+
+     - parameter subscriber: Subscriber that receives events.
+     */
+    public func subscribe<Subscriber: FlowSubscriberType>(_ subscriber: Subscriber) where Subscriber.Element == Element {
+        rxAbstractMethod()
+    }
+
+    /// Converts `self` to an `Observable` that requests all elements.
+    ///
+    /// - returns: Observable sequence that emits all elements of `self`.
+    public func asObservable() -> Observable<Element> {
+        FlowableAsObservable(source: self)
+    }
+
+    deinit {
+        #if TRACE_RESOURCES
+        _ = Resources.decrementTotal()
+        #endif
+    }
+}
+
+/// Adds `count` to `demand`, saturating at `Int.max` which represents unbounded demand.
+func flowDemand(_ demand: Int, adding count: Int) -> Int {
+    demand > Int.max - count ? Int.max : demand + count
+}
+
+/// Removes `count` delivered elements from `demand`. Unbounded demand stays unbounded.
+func flowDemand(_ demand: Int, removing count: Int) -> Int {
+    demand == Int.max ? Int.max : demand - count
+}
+
+/// Validates the argument of `FlowSubscription.request(_:)`.
+func isValidFlowRequest(_ count: Int) -> Bool {
+    if count <= 0 {
+        rxFatalErrorInDebug("Requested \(count) elements, requests must be positive.")
+        return false
+    }
+    return true
+}
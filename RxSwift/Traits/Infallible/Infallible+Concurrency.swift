@@ -35,5 +35,56 @@ public extension InfallibleType {
             }
         }
     }
+
+    /// Allows iterating over the values of an Infallible
+    /// asynchronously via Swift's concurrency features (`async/await`),
+    /// buffering elements that arrive while the consumer is busy according to `bufferingPolicy`.
+    ///
+    /// ```swift
+    /// for await value in infallible.values(bufferingPolicy: .bufferingNewest(16)) {
+    ///     // Handle emitted values
+    /// }
+    /// ```
+    ///
+    /// - parameter bufferingPolicy: Policy for elements that arrive while the consumer isn't waiting for them.
+    /// - returns: Asynchronous sequence of the elements.
+    func values(bufferingPolicy: AsyncValuesBufferingPolicy) -> InfallibleValues<Element> {
+        InfallibleValues(source: asObservable(), bufferingPolicy: bufferingPolicy)
+    }
+}
+
+/// Asynchronous sequence of the elements of an infallible sequence.
+///
+/// Every iteration subscribes to the source sequence once, and disposes the subscription when the iteration ends
+/// or its task is cancelled.
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+public struct InfallibleValues<Element>: AsyncSequence {
+    public typealias AsyncIterator = Iterator
+
+    private let source: Observable<Element>
+    private let bufferingPolicy: AsyncValuesBufferingPolicy
+
+    init(source: Observable<Element>, bufferingPolicy: AsyncValuesBufferingPolicy) {
+        self.source = source
+        self.bufferingPolicy = bufferingPolicy
+    }
+
+    public func makeAsyncIterator() -> Iterator {
+        Iterator(consumer: AsyncValuesConsumer(source: source, bufferingPolicy: bufferingPolicy))
+    }
+
+    public struct Iterator: AsyncIteratorProtocol {
+        private let consumer: AsyncValuesConsumer<Element>
+
+        init(consumer: AsyncValuesConsumer<Element>) {
+            self.consumer = consumer
+        }
+
+        /// - returns: Next element, or `nil` when the sequence completed, the task was cancelled or the subscription was disposed.
+        public mutating func next() async -> Element? {
+            // Infallible sources never error, the only possible error is disposal before completion.
+            try? await consumer.next()
+        }
+    }
 }
 #endif
@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/ExecutorSchedulerTests.swift
\ No newline at end of file
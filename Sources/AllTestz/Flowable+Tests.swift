@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/Flowable+Tests.swift
\ No newline at end of file
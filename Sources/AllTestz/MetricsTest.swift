@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/MetricsTest.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../Platform/NonRecursiveLock.swift
\ No newline at end of file
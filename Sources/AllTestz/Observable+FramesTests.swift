@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/Observable+FramesTests.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/Observable+ParallelTests.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../Tests/RxSwiftTests/Observable+TraceTests.swift
\ No newline at end of file
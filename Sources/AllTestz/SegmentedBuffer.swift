@@ -0,0 +1 @@
+../../Platform/DataStructures/SegmentedBuffer.swift
\ No newline at end of file
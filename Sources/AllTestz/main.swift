@@ -209,6 +209,10 @@ final class CurrentThreadSchedulerTest_ : CurrentThreadSchedulerTest, RxTestCase
     ("testCurrentThreadScheduler_basicScenario", CurrentThreadSchedulerTest.testCurrentThreadScheduler_basicScenario),
     ("testCurrentThreadScheduler_disposing1", CurrentThreadSchedulerTest.testCurrentThreadScheduler_disposing1),
     ("testCurrentThreadScheduler_disposing2", CurrentThreadSchedulerTest.testCurrentThreadScheduler_disposing2),
+    ("testCurrentThreadScheduler_reusesTrampolineAfterDraining", CurrentThreadSchedulerTest.testCurrentThreadScheduler_reusesTrampolineAfterDraining),
+    ("testCurrentThreadScheduler_trampolineIsPerThread", CurrentThreadSchedulerTest.testCurrentThreadScheduler_trampolineIsPerThread),
+    ("testCurrentThreadScheduler_sourcesInterleaveWithQueuedWork", CurrentThreadSchedulerTest.testCurrentThreadScheduler_sourcesInterleaveWithQueuedWork),
+    ("testCurrentThreadScheduler_sourceLoopStopsOnDispose", CurrentThreadSchedulerTest.testCurrentThreadScheduler_sourceLoopStopsOnDispose),
     ] }
 }
 
@@ -311,6 +315,33 @@ final class EventTests_ : EventTests, RxTestCase {
     ] }
 }
 
+final class FlowableTest_ : FlowableTest, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (FlowableTest_) -> () -> Void)] { return [
+    ("testFrom_EmitsOnlyRequestedElements", FlowableTest.testFrom_EmitsOnlyRequestedElements),
+    ("testFrom_CompletesWithoutDemand", FlowableTest.testFrom_CompletesWithoutDemand),
+    ("testFrom_Dispose", FlowableTest.testFrom_Dispose),
+    ("testMapFilter_PropagateDemand", FlowableTest.testMapFilter_PropagateDemand),
+    ("testMap_Error", FlowableTest.testMap_Error),
+    ("testAsObservable_RequestsEverything", FlowableTest.testAsObservable_RequestsEverything),
+    ("testToFlowable_Drop", FlowableTest.testToFlowable_Drop),
+    ("testToFlowable_Latest", FlowableTest.testToFlowable_Latest),
+    ("testToFlowable_BufferDropOldest", FlowableTest.testToFlowable_BufferDropOldest),
+    ("testToFlowable_BufferDropNewest", FlowableTest.testToFlowable_BufferDropNewest),
+    ("testToFlowable_BufferError", FlowableTest.testToFlowable_BufferError),
+    ("testToFlowable_CompletionWaitsForBufferedElements", FlowableTest.testToFlowable_CompletionWaitsForBufferedElements),
+    ("testToFlowable_BufferBlock", FlowableTest.testToFlowable_BufferBlock),
+    ("testFlatMap_LimitsConcurrencyAndDemand", FlowableTest.testFlatMap_LimitsConcurrencyAndDemand),
+    ("testFlatMap_InnerError", FlowableTest.testFlatMap_InnerError),
+    ("testObserveOn_RequestsAtMostBufferSizeAhead", FlowableTest.testObserveOn_RequestsAtMostBufferSizeAhead),
+    ] }
+}
+
 final class HistoricalSchedulerTest_ : HistoricalSchedulerTest, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -453,6 +484,22 @@ final class MaybeTest_ : MaybeTest, RxTestCase {
     ] }
 }
 
+final class MetricsTest_ : MetricsTest, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (MetricsTest_) -> () -> Void)] { return [
+    ("testDisabled_registersNothing", MetricsTest.testDisabled_registersNothing),
+    ("testInstrument_observeOnReportsEventsAndBufferDepth", MetricsTest.testInstrument_observeOnReportsEventsAndBufferDepth),
+    ("testInstrument_countsOnlyElements", MetricsTest.testInstrument_countsOnlyElements),
+    ("testInstrument_innermostNameWins", MetricsTest.testInstrument_innermostNameWins),
+    ("testTagging_replaySubjectReportsBufferDepth", MetricsTest.testTagging_replaySubjectReportsBufferDepth),
+    ] }
+}
+
 final class NSNotificationCenterTests_ : NSNotificationCenterTests, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -535,6 +582,15 @@ final class ObservableBlockingTest_ : ObservableBlockingTest, RxTestCase {
     ("testMaterialize_empty_fail", ObservableBlockingTest.testMaterialize_empty_fail),
     ("testMaterialize_someData", ObservableBlockingTest.testMaterialize_someData),
     ("testMaterialize_someData_fail", ObservableBlockingTest.testMaterialize_someData_fail),
+    ("testConditionToArray_someData", ObservableBlockingTest.testConditionToArray_someData),
+    ("testConditionToArray_withRealScheduler", ObservableBlockingTest.testConditionToArray_withRealScheduler),
+    ("testConditionFirst_withRealScheduler", ObservableBlockingTest.testConditionFirst_withRealScheduler),
+    ("testConditionToArray_fail", ObservableBlockingTest.testConditionToArray_fail),
+    ("testConditionToArray_timeout", ObservableBlockingTest.testConditionToArray_timeout),
+    ("testIterator_someData", ObservableBlockingTest.testIterator_someData),
+    ("testIterator_fail", ObservableBlockingTest.testIterator_fail),
+    ("testIterator_boundsProducer", ObservableBlockingTest.testIterator_boundsProducer),
+    ("testIterator_timeout", ObservableBlockingTest.testIterator_timeout),
     ] }
 }
 
@@ -673,6 +729,7 @@ final class ObservableCombineLatestTest_ : ObservableCombineLatestTest, RxTestCa
     ("testCombineLatest_typicalN", ObservableCombineLatestTest.testCombineLatest_typicalN),
     ("testCombineLatest_NAry_symmetric", ObservableCombineLatestTest.testCombineLatest_NAry_symmetric),
     ("testCombineLatest_NAry_asymmetric", ObservableCombineLatestTest.testCombineLatest_NAry_asymmetric),
+    ("testCombineLatest_NAry_manySources", ObservableCombineLatestTest.testCombineLatest_NAry_manySources),
     ] }
 }
 
@@ -742,6 +799,8 @@ final class ObservableDecodeTest_ : ObservableDecodeTest, RxTestCase {
     static var allTests: [(String, (ObservableDecodeTest_) -> () -> Void)] { return [
     ("testDecodeValidJSON", ObservableDecodeTest.testDecodeValidJSON),
     ("testDecodeInvalidJSON", ObservableDecodeTest.testDecodeInvalidJSON),
+    ("testDecodeInParallelKeepsOrder", ObservableDecodeTest.testDecodeInParallelKeepsOrder),
+    ("testDecodeInParallelFailsWithDecodingError", ObservableDecodeTest.testDecodeInParallelFailsWithDecodingError),
     ] }
 }
 
@@ -911,6 +970,25 @@ final class ObservableFilterTest_ : ObservableFilterTest, RxTestCase {
     ] }
 }
 
+final class ObservableFramesTest_ : ObservableFramesTest, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (ObservableFramesTest_) -> () -> Void)] { return [
+    ("testNewlineDelimited_splitsChunks", ObservableFramesTest.testNewlineDelimited_splitsChunks),
+    ("testNewlineDelimited_emitsLastFrameOnCompletion", ObservableFramesTest.testNewlineDelimited_emitsLastFrameOnCompletion),
+    ("testNewlineDelimited_slicesWithoutCopying", ObservableFramesTest.testNewlineDelimited_slicesWithoutCopying),
+    ("testNewlineDelimited_frameTooLong", ObservableFramesTest.testNewlineDelimited_frameTooLong),
+    ("testLengthPrefixed_splitsChunks", ObservableFramesTest.testLengthPrefixed_splitsChunks),
+    ("testLengthPrefixed_truncatedFrame", ObservableFramesTest.testLengthPrefixed_truncatedFrame),
+    ("testLengthPrefixed_frameTooLong", ObservableFramesTest.testLengthPrefixed_frameTooLong),
+    ("testFrames_error", ObservableFramesTest.testFrames_error),
+    ] }
+}
+
 final class ObservableGenerateTest_ : ObservableGenerateTest, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -951,6 +1029,9 @@ final class ObservableGroupByTest_ : ObservableGroupByTest, RxTestCase {
     ("testGroupBy_InnerEscapeComplete", ObservableGroupByTest.testGroupBy_InnerEscapeComplete),
     ("testGroupBy_InnerEscapeError", ObservableGroupByTest.testGroupBy_InnerEscapeError),
     ("testGroupBy_InnerEscapeDispose", ObservableGroupByTest.testGroupBy_InnerEscapeDispose),
+    ("testGroupBy_MaxGroupsEvictsLeastRecentlyActive", ObservableGroupByTest.testGroupBy_MaxGroupsEvictsLeastRecentlyActive),
+    ("testGroupBy_ExpiresIdleGroups", ObservableGroupByTest.testGroupBy_ExpiresIdleGroups),
+    ("testGroupBy_ExpiresSingleIdleGroup", ObservableGroupByTest.testGroupBy_ExpiresSingleIdleGroup),
     ] }
 }
 
@@ -992,6 +1073,9 @@ final class ObservableMapTest_ : ObservableMapTest, RxTestCase {
     ("testMapCompose_Dispose", ObservableMapTest.testMapCompose_Dispose),
     ("testMapCompose_Selector1Throws", ObservableMapTest.testMapCompose_Selector1Throws),
     ("testMapCompose_Selector2Throws", ObservableMapTest.testMapCompose_Selector2Throws),
+    ("testMapFilterCompactMapScanDoCompose_Range", ObservableMapTest.testMapFilterCompactMapScanDoCompose_Range),
+    ("testMapScanCompose_SubscriptionsHaveIndependentState", ObservableMapTest.testMapScanCompose_SubscriptionsHaveIndependentState),
+    ("testFilterScanCompose_Selector2Throws", ObservableMapTest.testFilterScanCompose_Selector2Throws),
     ] }
 }
 
@@ -1070,6 +1154,14 @@ final class ObservableMergeTest_ : ObservableMergeTest, RxTestCase {
     ("testConcatMap_Error_Inner", ObservableMergeTest.testConcatMap_Error_Inner),
     ("testConcatMap_Throw", ObservableMergeTest.testConcatMap_Throw),
     ("testConcatMap_UseFunction", ObservableMergeTest.testConcatMap_UseFunction),
+    ("testConcatMapEager_SubscribesConcurrentlyEmitsInOrder", ObservableMergeTest.testConcatMapEager_SubscribesConcurrentlyEmitsInOrder),
+    ("testConcatMapEager_MaxConcurrentLimitsSubscriptions", ObservableMergeTest.testConcatMapEager_MaxConcurrentLimitsSubscriptions),
+    ("testConcatMapEager_InnerError", ObservableMergeTest.testConcatMapEager_InnerError),
+    ("testConcatMapEager_SelectorThrows", ObservableMergeTest.testConcatMapEager_SelectorThrows),
+    ("testConcatMapEager_PrefetchOverflow", ObservableMergeTest.testConcatMapEager_PrefetchOverflow),
+    ("testConcatMapEager_PrefetchDoesntLimitSynchronousHead", ObservableMergeTest.testConcatMapEager_PrefetchDoesntLimitSynchronousHead),
+    ("testConcatMapEager_Disposed", ObservableMergeTest.testConcatMapEager_Disposed),
+    ("testConcatMapEager_SynchronousInnerSequencesDontRecurse", ObservableMergeTest.testConcatMapEager_SynchronousInnerSequencesDontRecurse),
     ] }
 }
 
@@ -1138,6 +1230,13 @@ final class ObservableObserveOnTest_ : ObservableObserveOnTest, RxTestCase {
     ("testObserveOnDispatchQueue_Empty", ObservableObserveOnTest.testObserveOnDispatchQueue_Empty),
     ("testObserveOnDispatchQueue_Error", ObservableObserveOnTest.testObserveOnDispatchQueue_Error),
     ("testObserveOnDispatchQueue_Dispose", ObservableObserveOnTest.testObserveOnDispatchQueue_Dispose),
+    ("testObserveOnBuffered_DeliversInOrder", ObservableObserveOnTest.testObserveOnBuffered_DeliversInOrder),
+    ("testObserveOnBuffered_DropNewest", ObservableObserveOnTest.testObserveOnBuffered_DropNewest),
+    ("testObserveOnBuffered_DropOldest", ObservableObserveOnTest.testObserveOnBuffered_DropOldest),
+    ("testObserveOnBuffered_Error", ObservableObserveOnTest.testObserveOnBuffered_Error),
+    ("testObserveOnBuffered_ErrorDisposesSourceOnOverflow", ObservableObserveOnTest.testObserveOnBuffered_ErrorDisposesSourceOnOverflow),
+    ("testObserveOnBuffered_Dispose", ObservableObserveOnTest.testObserveOnBuffered_Dispose),
+    ("testObserveOnBuffered_BlockDeliversEverything", ObservableObserveOnTest.testObserveOnBuffered_BlockDeliversEverything),
     ] }
 }
 
@@ -1174,6 +1273,26 @@ final class ObservableOptionalTest_ : ObservableOptionalTest, RxTestCase {
     ] }
 }
 
+final class ObservableParallelTest_ : ObservableParallelTest, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (ObservableParallelTest_) -> () -> Void)] { return [
+    ("testParallel_orderedPreservesSourceOrder", ObservableParallelTest.testParallel_orderedPreservesSourceOrder),
+    ("testParallel_unorderedDeliversAllElements", ObservableParallelTest.testParallel_unorderedDeliversAllElements),
+    ("testParallel_filterAndCompactMap", ObservableParallelTest.testParallel_filterAndCompactMap),
+    ("testParallel_runsRailsOnMultipleThreads", ObservableParallelTest.testParallel_runsRailsOnMultipleThreads),
+    ("testParallel_transformErrorTerminatesSequence", ObservableParallelTest.testParallel_transformErrorTerminatesSequence),
+    ("testParallel_unorderedTransformErrorFollowsPrecedingElements", ObservableParallelTest.testParallel_unorderedTransformErrorFollowsPrecedingElements),
+    ("testParallel_sourceError", ObservableParallelTest.testParallel_sourceError),
+    ("testParallel_emptySourceCompletes", ObservableParallelTest.testParallel_emptySourceCompletes),
+    ("testParallel_immediateSchedulerKeepsOrder", ObservableParallelTest.testParallel_immediateSchedulerKeepsOrder),
+    ] }
+}
+
 final class ObservablePrimitiveSequenceTest_ : ObservablePrimitiveSequenceTest, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -1365,6 +1484,13 @@ final class ObservableSequenceTest_ : ObservableSequenceTest, RxTestCase {
     ("testSequenceOf_dispose", ObservableSequenceTest.testSequenceOf_dispose),
     ("testFromAnySequence_basic_immediate", ObservableSequenceTest.testFromAnySequence_basic_immediate),
     ("testToObservableAnySequence_basic_testScheduler", ObservableSequenceTest.testToObservableAnySequence_basic_testScheduler),
+    ("testFromArrayBatched_deliversBatchesThroughOperators", ObservableSequenceTest.testFromArrayBatched_deliversBatchesThroughOperators),
+    ("testFromArrayBatched_dispose", ObservableSequenceTest.testFromArrayBatched_dispose),
+    ("testFromArrayBatched_errorInsideBatch", ObservableSequenceTest.testFromArrayBatched_errorInsideBatch),
+    ("testFromArrayBatched_nonBatchObserverStopsEarly", ObservableSequenceTest.testFromArrayBatched_nonBatchObserverStopsEarly),
+    ("testFromArrayBatched_aggregates", ObservableSequenceTest.testFromArrayBatched_aggregates),
+    ("testFromArrayBatched_errorInsideBatchForwardsCompletedResults", ObservableSequenceTest.testFromArrayBatched_errorInsideBatchForwardsCompletedResults),
+    ("testUnbatched", ObservableSequenceTest.testUnbatched),
     ] }
 }
 
@@ -1383,6 +1509,9 @@ final class ObservableShareReplayScopeTests_ : ObservableShareReplayScopeTests,
     ("test_whileConnected_error", ObservableShareReplayScopeTests.test_whileConnected_error),
     ("test_forever_completed", ObservableShareReplayScopeTests.test_forever_completed),
     ("test_whileConnected_completed", ObservableShareReplayScopeTests.test_whileConnected_completed),
+    ("test_whileConnected_replaysAcrossSegments", ObservableShareReplayScopeTests.test_whileConnected_replaysAcrossSegments),
+    ("test_whileConnected_subscribeWhileEmitting", ObservableShareReplayScopeTests.test_whileConnected_subscribeWhileEmitting),
+    ("test_whileConnected_replayDoesntBlockSource", ObservableShareReplayScopeTests.test_whileConnected_replayDoesntBlockSource),
     ] }
 }
 
@@ -1512,6 +1641,8 @@ final class ObservableSubscriptionTests_ : ObservableSubscriptionTests, RxTestCa
     ("testSubscribeOnError", ObservableSubscriptionTests.testSubscribeOnError),
     ("testSubscribeOnCompleted", ObservableSubscriptionTests.testSubscribeOnCompleted),
     ("testDisposed", ObservableSubscriptionTests.testDisposed),
+    ("testSubscribeWithoutOnDisposed_disposesUpstream", ObservableSubscriptionTests.testSubscribeWithoutOnDisposed_disposesUpstream),
+    ("testCreate_ignoresEventsAfterTerminationAndDisposal", ObservableSubscriptionTests.testCreate_ignoresEventsAfterTerminationAndDisposal),
     ] }
 }
 
@@ -1765,6 +1896,20 @@ final class ObservableToArrayTest_ : ObservableToArrayTest, RxTestCase {
     ] }
 }
 
+final class ObservableTraceTest_ : ObservableTraceTest, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (ObservableTraceTest_) -> () -> Void)] { return [
+    ("testTrace_disabledForwardsWithoutRecording", ObservableTraceTest.testTrace_disabledForwardsWithoutRecording),
+    ("testTrace_recordsSubscriptionLifetime", ObservableTraceTest.testTrace_recordsSubscriptionLifetime),
+    ("testTrace_separatesSubscriptions", ObservableTraceTest.testTrace_separatesSubscriptions),
+    ] }
+}
+
 final class ObservableUsingTest_ : ObservableUsingTest, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -1880,6 +2025,7 @@ final class ObservableZipTest_ : ObservableZipTest, RxTestCase {
     ("testZip_NAry_asymmetric", ObservableZipTest.testZip_NAry_asymmetric),
     ("testZip_NAry_error", ObservableZipTest.testZip_NAry_error),
     ("testZip_NAry_atLeastOneErrors4", ObservableZipTest.testZip_NAry_atLeastOneErrors4),
+    ("testZip_NAry_manySources", ObservableZipTest.testZip_NAry_manySources),
     ] }
 }
 
@@ -1924,6 +2070,7 @@ final class PublishSubjectTest_ : PublishSubjectTest, RxTestCase {
     ("test_hasObserversNoObservers", PublishSubjectTest.test_hasObserversNoObservers),
     ("test_hasObserversOneObserver", PublishSubjectTest.test_hasObserversOneObserver),
     ("test_hasObserversManyObserver", PublishSubjectTest.test_hasObserversManyObserver),
+    ("test_unsubscribeDuringDispatchAffectsOnlyNextEvents", PublishSubjectTest.test_unsubscribeDuringDispatchAffectsOnlyNextEvents),
     ] }
 }
 
@@ -1967,6 +2114,7 @@ final class ReplayRelayTests_ : ReplayRelayTests, RxTestCase {
     ("test_fewerEventsThanBufferSize", ReplayRelayTests.test_fewerEventsThanBufferSize),
     ("test_moreEventsThanBufferSize", ReplayRelayTests.test_moreEventsThanBufferSize),
     ("test_moreEventsThanBufferSizeMultipleObservers", ReplayRelayTests.test_moreEventsThanBufferSizeMultipleObservers),
+    ("test_timeWindow", ReplayRelayTests.test_timeWindow),
     ] }
 }
 
@@ -1989,6 +2137,11 @@ final class ReplaySubjectTest_ : ReplaySubjectTest, RxTestCase {
     ("test_subscribingAfterComplete", ReplaySubjectTest.test_subscribingAfterComplete),
     ("test_subscribingBeforeError", ReplaySubjectTest.test_subscribingBeforeError),
     ("test_subscribingAfterError", ReplaySubjectTest.test_subscribingAfterError),
+    ("test_replaysAcrossSegments", ReplaySubjectTest.test_replaysAcrossSegments),
+    ("test_unboundedReplaysAcrossSegments", ReplaySubjectTest.test_unboundedReplaysAcrossSegments),
+    ("test_snapshotIsNotAffectedByLaterElements", ReplaySubjectTest.test_snapshotIsNotAffectedByLaterElements),
+    ("test_timeWindow_dropsExpiredElements", ReplaySubjectTest.test_timeWindow_dropsExpiredElements),
+    ("test_timeWindow_boundedBySize", ReplaySubjectTest.test_timeWindow_boundedBySize),
     ] }
 }
 
@@ -2178,6 +2331,24 @@ final class SingleTest_ : SingleTest, RxTestCase {
     ] }
 }
 
+final class TimerWheelSchedulerTests_ : TimerWheelSchedulerTests, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (TimerWheelSchedulerTests_) -> () -> Void)] { return [
+    ("test_scheduleRelativeOrdering", TimerWheelSchedulerTests.test_scheduleRelativeOrdering),
+    ("test_scheduleRelativeNeverRunsEarly", TimerWheelSchedulerTests.test_scheduleRelativeNeverRunsEarly),
+    ("test_scheduleRelativeBeyondWheelRange", TimerWheelSchedulerTests.test_scheduleRelativeBeyondWheelRange),
+    ("test_scheduleRelativeSaturatesFarFuture", TimerWheelSchedulerTests.test_scheduleRelativeSaturatesFarFuture),
+    ("test_scheduleRelativeCancel", TimerWheelSchedulerTests.test_scheduleRelativeCancel),
+    ("test_scheduleRelativeDisposesActionResult", TimerWheelSchedulerTests.test_scheduleRelativeDisposesActionResult),
+    ("test_debounce", TimerWheelSchedulerTests.test_debounce),
+    ] }
+}
+
 final class VirtualSchedulerTest_ : VirtualSchedulerTest, RxTestCase {
     #if os(macOS)
     required override init() {
@@ -2195,6 +2366,10 @@ final class VirtualSchedulerTest_ : VirtualSchedulerTest, RxTestCase {
     ("testVirtualScheduler_stop", VirtualSchedulerTest.testVirtualScheduler_stop),
     ("testVirtualScheduler_sleep", VirtualSchedulerTest.testVirtualScheduler_sleep),
     ("testVirtualScheduler_stress", VirtualSchedulerTest.testVirtualScheduler_stress),
+    ("testVirtualScheduler_disposeAfterRunDoesntAffectLaterItems", VirtualSchedulerTest.testVirtualScheduler_disposeAfterRunDoesntAffectLaterItems),
+    ("testVirtualScheduler_disposeAfterRunDisposesActionResult", VirtualSchedulerTest.testVirtualScheduler_disposeAfterRunDisposesActionResult),
+    ("testVirtualScheduler_stressWithCancellation", VirtualSchedulerTest.testVirtualScheduler_stressWithCancellation),
+    ("testVirtualScheduler_disposeFromAnotherThreadWhileRunning", VirtualSchedulerTest.testVirtualScheduler_disposeFromAnotherThreadWhileRunning),
     ] }
 }
 
@@ -2212,6 +2387,23 @@ final class WithUnretainedTests_ : WithUnretainedTests, RxTestCase {
     ("testResultsSelector", WithUnretainedTests.testResultsSelector),
     ] }
 }
+
+final class WorkStealingSchedulerTests_ : WorkStealingSchedulerTests, RxTestCase {
+    #if os(macOS)
+    required override init() {
+        super.init()
+    }
+    #endif
+
+    static var allTests: [(String, (WorkStealingSchedulerTests_) -> () -> Void)] { return [
+    ("test_schedule", WorkStealingSchedulerTests.test_schedule),
+    ("test_scheduleCancel", WorkStealingSchedulerTests.test_scheduleCancel),
+    ("test_scheduleRunsExternalActionsInOrder", WorkStealingSchedulerTests.test_scheduleRunsExternalActionsInOrder),
+    ("test_scheduleRecursiveDoesntStarveExternalActions", WorkStealingSchedulerTests.test_scheduleRecursiveDoesntStarveExternalActions),
+    ("test_scheduleRecursiveStaysOnWorker", WorkStealingSchedulerTests.test_scheduleRecursiveStaysOnWorker),
+    ("test_scheduleRelative", WorkStealingSchedulerTests.test_scheduleRelative),
+    ] }
+}
 #if os(macOS) || os(iOS) || os(tvOS) || os(watchOS)
 
 func testCase<T: RxTestCase>(_ tests: [(String, (T) -> () -> Void)]) -> () -> Void {
@@ -2251,11 +2443,13 @@ func XCTMain(_ tests: [() -> Void]) {
         testCase(DisposeBagTest_.allTests),
         testCase(DriverTest_.allTests),
         testCase(EventTests_.allTests),
+        testCase(FlowableTest_.allTests),
         testCase(HistoricalSchedulerTest_.allTests),
         testCase(InfallibleCombineLatestTest_.allTests),
         testCase(InfallibleTest_.allTests),
         testCase(MainSchedulerTest_.allTests),
         testCase(MaybeTest_.allTests),
+        testCase(MetricsTest_.allTests),
         testCase(NSNotificationCenterTests_.allTests),
         testCase(ObservableAmbTest_.allTests),
         testCase(ObservableBlockingTest_.allTests),
@@ -2275,6 +2469,7 @@ func XCTMain(_ tests: [() -> Void]) {
         testCase(ObservableElementAtTest_.allTests),
         testCase(ObservableEnumeratedTest_.allTests),
         testCase(ObservableFilterTest_.allTests),
+        testCase(ObservableFramesTest_.allTests),
         testCase(ObservableGenerateTest_.allTests),
         testCase(ObservableGroupByTest_.allTests),
         testCase(ObservableJustTest_.allTests),
@@ -2285,6 +2480,7 @@ func XCTMain(_ tests: [() -> Void]) {
         testCase(ObservableObserveOnTest_.allTests),
         testCase(ObservableObserveOnTestConcurrentSchedulerTest_.allTests),
         testCase(ObservableOptionalTest_.allTests),
+        testCase(ObservableParallelTest_.allTests),
         testCase(ObservablePrimitiveSequenceTest_.allTests),
         testCase(ObservableRangeTest_.allTests),
         testCase(ObservableReduceTest_.allTests),
@@ -2313,6 +2509,7 @@ func XCTMain(_ tests: [() -> Void]) {
         testCase(ObservableTimeoutTest_.allTests),
         testCase(ObservableTimerTest_.allTests),
         testCase(ObservableToArrayTest_.allTests),
+        testCase(ObservableTraceTest_.allTests),
         testCase(ObservableUsingTest_.allTests),
         testCase(ObservableWindowTest_.allTests),
         testCase(ObservableWithLatestFromTest_.allTests),
@@ -2328,7 +2525,9 @@ func XCTMain(_ tests: [() -> Void]) {
         testCase(SharingSchedulerTest_.allTests),
         testCase(SignalTests_.allTests),
         testCase(SingleTest_.allTests),
+        testCase(TimerWheelSchedulerTests_.allTests),
         testCase(VirtualSchedulerTest_.allTests),
         testCase(WithUnretainedTests_.allTests),
+        testCase(WorkStealingSchedulerTests_.allTests),
     ])
 //}
@@ -0,0 +1 @@
+../../RxBlocking/BlockingObservable+Iterator.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxBlocking/ConditionLock.swift
\ No newline at end of file
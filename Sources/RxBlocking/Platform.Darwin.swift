@@ -1 +0,0 @@
-../../RxBlocking/Platform/Platform.Darwin.swift
\ No newline at end of file
@@ -1 +0,0 @@
-../../RxBlocking/Platform/Platform.Linux.swift
\ No newline at end of file
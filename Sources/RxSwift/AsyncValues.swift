@@ -0,0 +1 @@
+../../RxSwift/AsyncValues.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Observers/BatchObserverType.swift
\ No newline at end of file
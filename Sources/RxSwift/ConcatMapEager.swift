@@ -0,0 +1 @@
+../../RxSwift/Observables/ConcatMapEager.swift
\ No newline at end of file
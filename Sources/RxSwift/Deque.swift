@@ -0,0 +1 @@
+../../RxSwift/Platform/DataStructures/Deque.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Schedulers/ExecutorScheduler.swift
\ No newline at end of file
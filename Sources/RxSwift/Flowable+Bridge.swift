@@ -0,0 +1 @@
+../../RxSwift/Traits/Flowable/Flowable+Bridge.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Traits/Flowable/Flowable+Create.swift
\ No newline at end of file
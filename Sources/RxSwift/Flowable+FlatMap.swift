@@ -0,0 +1 @@
+../../RxSwift/Traits/Flowable/Flowable+FlatMap.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Traits/Flowable/Flowable+Operators.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Traits/Flowable/Flowable.swift
\ No newline at end of file
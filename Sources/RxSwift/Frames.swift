@@ -0,0 +1 @@
+../../RxSwift/Observables/Frames.swift
\ No newline at end of file
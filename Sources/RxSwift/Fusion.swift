@@ -0,0 +1 @@
+../../RxSwift/Observables/Fusion.swift
\ No newline at end of file
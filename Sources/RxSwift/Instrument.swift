@@ -0,0 +1 @@
+../../RxSwift/Observables/Instrument.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Metrics.swift
\ No newline at end of file
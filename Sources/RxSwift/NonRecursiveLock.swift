@@ -0,0 +1 @@
+../../RxSwift/Platform/NonRecursiveLock.swift
\ No newline at end of file
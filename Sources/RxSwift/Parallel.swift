@@ -0,0 +1 @@
+../../RxSwift/Observables/Parallel.swift
\ No newline at end of file
@@ -1 +0,0 @@
-../../RxSwift/Platform/Platform.Darwin.swift
\ No newline at end of file
@@ -1 +0,0 @@
-../../RxSwift/Platform/Platform.Linux.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Platform/DataStructures/RingBuffer.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Platform/DataStructures/SegmentedBuffer.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Schedulers/TimerWheelScheduler.swift
\ No newline at end of file
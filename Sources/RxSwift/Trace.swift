@@ -0,0 +1 @@
+../../RxSwift/Observables/Trace.swift
\ No newline at end of file
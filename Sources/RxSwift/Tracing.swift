@@ -0,0 +1 @@
+../../RxSwift/Tracing.swift
\ No newline at end of file
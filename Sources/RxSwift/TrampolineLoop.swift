@@ -0,0 +1 @@
+../../RxSwift/Schedulers/Internal/TrampolineLoop.swift
\ No newline at end of file
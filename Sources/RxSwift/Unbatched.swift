@@ -0,0 +1 @@
+../../RxSwift/Observables/Unbatched.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../RxSwift/Schedulers/WorkStealingScheduler.swift
\ No newline at end of file
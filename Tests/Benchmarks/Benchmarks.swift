@@ -86,6 +86,56 @@ class Benchmarks: XCTestCase {
         }
     }
 
+    func testPublishSubjectSubscriptionChurn_1() {
+        measurePublishSubjectSubscriptionChurn(observers: 1)
+    }
+
+    func testPublishSubjectSubscriptionChurn_100() {
+        measurePublishSubjectSubscriptionChurn(observers: 100)
+    }
+
+    func testPublishSubjectSubscriptionChurn_10000() {
+        measurePublishSubjectSubscriptionChurn(observers: 10000)
+    }
+
+    func testPublishSubjectSubscriptionChurn_100000() {
+        measurePublishSubjectSubscriptionChurn(observers: 100_000)
+    }
+
+    /// Subscribes `observers` observers, sends one element, and then unsubscribes them
+    /// interleaved from both ends, which exercises the subject's observer bag at scale.
+    private func measurePublishSubjectSubscriptionChurn(observers: Int) {
+        measure {
+            var sum = 0
+            let subject = PublishSubject<Int>()
+
+            var subscriptions = [Disposable]()
+            subscriptions.reserveCapacity(observers)
+
+            for _ in 0 ..< observers {
+                subscriptions.append(subject.subscribe(onNext: { x in
+                    sum += x
+                }))
+            }
+
+            subject.on(.next(1))
+
+            var front = 0
+            var back = observers - 1
+            while front <= back {
+                subscriptions[front].dispose()
+                if front != back {
+                    subscriptions[back].dispose()
+                }
+                front += 1
+                back -= 1
+            }
+
+            XCTAssertFalse(subject.hasObservers)
+            XCTAssertEqual(sum, observers)
+        }
+    }
+
     func testMapFilterPumping() {
         measure {
             var sum = 0
@@ -111,6 +161,160 @@ class Benchmarks: XCTestCase {
         }
     }
 
+    func testMapFilterReduceFromArray() {
+        let elements = [Int](repeating: 1, count: iterations * 10)
+        measure {
+            var sum = 0
+            _ = Observable.from(elements)
+                .map { $0 * 2 }.filter { _ in true }
+                .reduce(0, accumulator: +)
+                .subscribe(onNext: { sum = $0 })
+
+            XCTAssertEqual(sum, iterations * 20)
+        }
+    }
+
+    func testMapFilterReduceFromArrayBatched() {
+        let elements = [Int](repeating: 1, count: iterations * 10)
+        measure {
+            var sum = 0
+            _ = Observable.from(elements, batchSize: 1024)
+                .map { $0 * 2 }.filter { _ in true }
+                .reduce(0, accumulator: +)
+                .subscribe(onNext: { sum = $0 })
+
+            XCTAssertEqual(sum, iterations * 20)
+        }
+    }
+
+    func testObserveOnSerialQueuePumping() {
+        measure {
+            observeOnPumping { $0.observe(on: SerialDispatchQueueScheduler(qos: .default)) }
+        }
+    }
+
+    func testObserveOnBufferedPumping() {
+        measure {
+            observeOnPumping { $0.observe(on: SerialDispatchQueueScheduler(qos: .default), bufferSize: 1024, overflow: .block) }
+        }
+    }
+
+    private func observeOnPumping(_ observeOn: (Observable<Int>) -> Observable<Int>) {
+        let done = expectation(description: "done")
+        var sum = 0
+        let subject = PublishSubject<Int>()
+
+        let subscription = observeOn(subject.asObservable())
+            .subscribe(onNext: { x in
+                sum += x
+            }, onCompleted: {
+                done.fulfill()
+            })
+
+        for _ in 0 ..< iterations * 10 {
+            subject.on(.next(1))
+        }
+        subject.on(.completed)
+
+        wait(for: [done], timeout: 100)
+        subscription.dispose()
+
+        XCTAssertEqual(sum, iterations * 10)
+    }
+
+    func testDebounceRearmingSerialQueue() {
+        measure {
+            debounceRearming(SerialDispatchQueueScheduler(qos: .default))
+        }
+    }
+
+    func testDebounceRearmingTimerWheel() {
+        measure {
+            debounceRearming(TimerWheelScheduler())
+        }
+    }
+
+    private func debounceRearming(_ scheduler: SchedulerType) {
+        let done = expectation(description: "done")
+        var subscriptions = [Disposable]()
+        let subject = PublishSubject<Int>()
+        var delivered = 0
+
+        for _ in 0 ..< 1000 {
+            subscriptions.append(subject
+                .debounce(.seconds(10), scheduler: scheduler)
+                .subscribe(onCompleted: {
+                    delivered += 1
+                    if delivered == 1000 {
+                        done.fulfill()
+                    }
+                }))
+        }
+
+        for i in 0 ..< iterations / 10 {
+            subject.on(.next(i))
+        }
+        subject.on(.completed)
+
+        wait(for: [done], timeout: 100)
+        subscriptions.forEach { $0.dispose() }
+    }
+
+    func testCPUBoundMapSerial() {
+        measure {
+            cpuBoundMapping { $0.map(cpuBoundWork) }
+        }
+    }
+
+    func testCPUBoundMapParallel() {
+        let scheduler = WorkStealingScheduler()
+
+        measure {
+            cpuBoundMapping { $0.parallel(on: scheduler).map(cpuBoundWork).sequential(ordered: true) }
+        }
+    }
+
+    private func cpuBoundMapping(_ transform: (Observable<Int>) -> Observable<Int>) {
+        let done = expectation(description: "done")
+        var count = 0
+
+        let subscription = transform(Observable.from(Array(0 ..< iterations / 10)))
+            .subscribe(onNext: { _ in
+                count += 1
+            }, onCompleted: {
+                done.fulfill()
+            })
+
+        wait(for: [done], timeout: 100)
+        subscription.dispose()
+
+        XCTAssertEqual(count, iterations / 10)
+    }
+
+    func testHistoricalSchedulerReplay() {
+        measure {
+            let scheduler = HistoricalScheduler()
+            var fired = 0
+            var timeouts = [Disposable]()
+
+            for i in 0 ..< iterations * 10 {
+                let dueTime = RxTimeInterval.milliseconds((i * 7919) % 86_400_000)
+                _ = scheduler.scheduleRelative((), dueTime: dueTime) { _ in
+                    fired += 1
+                    return Disposables.create()
+                }
+                timeouts.append(scheduler.scheduleRelative((), dueTime: dueTime) { _ in
+                    Disposables.create()
+                })
+            }
+
+            timeouts.forEach { $0.dispose() }
+            scheduler.start()
+
+            XCTAssertEqual(fired, iterations * 10)
+        }
+    }
+
     func testMapFilterCreating() {
         measure {
             var sum = 0
@@ -349,3 +553,11 @@ class Benchmarks: XCTestCase {
         }
     }
 }
+
+private func cpuBoundWork(_ value: Int) -> Int {
+    var hash = value
+    for _ in 0 ..< 10000 {
+        hash = hash &* 31 &+ 7
+    }
+    return hash
+}
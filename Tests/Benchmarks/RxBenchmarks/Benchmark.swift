@@ -0,0 +1,144 @@
+//
+//  Benchmark.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+import RxMallocCounter
+
+/// Single benchmark case.
+struct Benchmark {
+    /// Unique name, results are matched against a baseline by it.
+    let name: String
+    /// What a unit of work is, e.g. `event` or `subscription`.
+    let unit: String
+    /// Number of units performed by one call of `body`.
+    let units: Int
+    let body: () -> Void
+
+    init(_ name: String, unit: String = "event", units: Int, body: @escaping () -> Void) {
+        self.name = name
+        self.unit = unit
+        self.units = units
+        self.body = body
+    }
+}
+
+struct BenchmarkResult: Codable {
+    let name: String
+    let unit: String
+    let nanosecondsPerUnit: Double
+    /// `nil` when allocations can't be counted on this platform.
+    let allocationsPerUnit: Double?
+    let bytesPerUnit: Double?
+}
+
+struct BenchmarkRunner {
+    /// Number of timed runs, the fastest one is reported.
+    let repetitions: Int
+
+    func run(_ benchmark: Benchmark) -> BenchmarkResult {
+        let units = Double(benchmark.units)
+
+        // warm up
+        benchmark.body()
+
+        var fastest = UInt64.max
+        for _ in 0 ..< repetitions {
+            let start = DispatchTime.now().uptimeNanoseconds
+            benchmark.body()
+            fastest = min(fastest, DispatchTime.now().uptimeNanoseconds - start)
+        }
+
+        // Allocations are counted in a separate run so counting doesn't skew the timing.
+        var allocationsPerUnit: Double?
+        var bytesPerUnit: Double?
+
+        let allocations = rx_malloc_counter_allocations()
+        let bytes = rx_malloc_counter_bytes()
+        if rx_malloc_counter_start() {
+            benchmark.body()
+            rx_malloc_counter_stop()
+
+            allocationsPerUnit = Double(rx_malloc_counter_allocations() - allocations) / units
+            bytesPerUnit = Double(rx_malloc_counter_bytes() - bytes) / units
+        }
+
+        return BenchmarkResult(
+            name: benchmark.name,
+            unit: benchmark.unit,
+            nanosecondsPerUnit: Double(fastest) / units,
+            allocationsPerUnit: allocationsPerUnit,
+            bytesPerUnit: bytesPerUnit
+        )
+    }
+}
+
+/// Result that got worse compared to the baseline.
+struct Regression: CustomStringConvertible {
+    let name: String
+    let metric: String
+    let baseline: Double
+    let current: Double
+
+    var description: String {
+        let change = String(format: "%+.1f%%", (current / baseline - 1) * 100)
+        return "\(name): \(metric) \(String(format: "%.2f", baseline)) -> \(String(format: "%.2f", current)) (\(change))"
+    }
+}
+
+/**
+ Compares `results` to `baseline`.
+
+ Time is noisy, so it's only reported when it got slower by more than `timeTolerance`.
+ Allocation counts are deterministic for single threaded benchmarks, so any increase by at least
+ one allocation per hundred units is reported.
+ */
+func regressions(of results: [BenchmarkResult], against baseline: [BenchmarkResult], timeTolerance: Double) -> [Regression] {
+    let baselineByName = Dictionary(baseline.map { ($0.name, $0) }, uniquingKeysWith: { $1 })
+
+    var regressions = [Regression]()
+
+    for result in results {
+        guard let previous = baselineByName[result.name] else {
+            continue
+        }
+
+        if result.nanosecondsPerUnit > previous.nanosecondsPerUnit * (1 + timeTolerance) {
+            regressions.append(Regression(name: result.name, metric: "ns/\(result.unit)", baseline: previous.nanosecondsPerUnit, current: result.nanosecondsPerUnit))
+        }
+
+        if let allocations = result.allocationsPerUnit, let previousAllocations = previous.allocationsPerUnit, allocations >= previousAllocations + 0.01 {
+            regressions.append(Regression(name: result.name, metric: "allocations/\(result.unit)", baseline: previousAllocations, current: allocations))
+        }
+    }
+
+    return regressions
+}
+
+func printTable(_ results: [BenchmarkResult]) {
+    func column(_ value: String, _ width: Int) -> String {
+        value.count >= width ? value : value + String(repeating: " ", count: width - value.count)
+    }
+
+    func format(_ value: Double?) -> String {
+        value.map { String(format: "%.2f", $0) } ?? "n/a"
+    }
+
+    let nameWidth = max(results.map(\.name.count).max() ?? 0, 4) + 2
+
+    print(column("name", nameWidth) + column("unit", 14) + column("ns/unit", 12) + column("allocs/unit", 13) + "bytes/unit")
+    for result in results {
+        print(
+            column(result.name, nameWidth)
+                + column(result.unit, 14)
+                + column(format(result.nanosecondsPerUnit), 12)
+                + column(format(result.allocationsPerUnit), 13)
+                + format(result.bytesPerUnit)
+        )
+    }
+}
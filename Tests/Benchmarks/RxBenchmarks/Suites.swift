@@ -0,0 +1,427 @@
+//
+//  Suites.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Dispatch
+import Foundation
+import RxRelay
+import RxSwift
+
+private let events = 10000
+private let subscriptions = 1000
+private let handoffs = 1000
+
+/// Blocks until `observable` terminates.
+private func waitForTermination<Element>(_ observable: Observable<Element>) {
+    let semaphore = DispatchSemaphore(value: 0)
+    let subscription = observable.subscribe(onError: { _ in semaphore.signal() }, onCompleted: { semaphore.signal() })
+    semaphore.wait()
+    subscription.dispose()
+}
+
+private func range() -> Observable<Int> {
+    Observable.range(start: 0, count: events)
+}
+
+func subjectBenchmarks() -> [Benchmark] {
+    [
+        Benchmark("PublishSubject 1 subscriber", units: events) {
+            let subject = PublishSubject<Int>()
+            let subscription = subject.subscribe(onNext: { _ in })
+            for i in 0 ..< events {
+                subject.on(.next(i))
+            }
+            subscription.dispose()
+        },
+        Benchmark("PublishSubject 10 subscribers", units: events * 10) {
+            let subject = PublishSubject<Int>()
+            let subscriptions = (0 ..< 10).map { _ in subject.subscribe(onNext: { _ in }) }
+            for i in 0 ..< events {
+                subject.on(.next(i))
+            }
+            subscriptions.forEach { $0.dispose() }
+        },
+        Benchmark("BehaviorSubject", units: events) {
+            let subject = BehaviorSubject(value: 0)
+            let subscription = subject.subscribe(onNext: { _ in })
+            for i in 0 ..< events {
+                subject.on(.next(i))
+            }
+            subscription.dispose()
+        },
+        Benchmark("ReplaySubject(1)", units: events) {
+            let subject = ReplaySubject<Int>.create(bufferSize: 1)
+            let subscription = subject.subscribe(onNext: { _ in })
+            for i in 0 ..< events {
+                subject.on(.next(i))
+            }
+            subscription.dispose()
+        },
+        Benchmark("PublishRelay", units: events) {
+            let relay = PublishRelay<Int>()
+            let subscription = relay.subscribe(onNext: { _ in })
+            for i in 0 ..< events {
+                relay.accept(i)
+            }
+            subscription.dispose()
+        }
+    ]
+}
+
+func operatorBenchmarks() -> [Benchmark] {
+    [
+        Benchmark("map filter", units: events) {
+            _ = range()
+                .map { $0 + 1 }
+                .filter { $0 % 2 == 0 }
+                .subscribe()
+        },
+        Benchmark("scan reduce", units: events) {
+            _ = range()
+                .scan(0, accumulator: +)
+                .reduce(0, accumulator: +)
+                .subscribe()
+        },
+        Benchmark("flatMap", units: events) {
+            _ = range()
+                .flatMap { Observable.just($0) }
+                .subscribe()
+        },
+        Benchmark("flatMapLatest", units: events) {
+            _ = range()
+                .flatMapLatest { Observable.just($0) }
+                .subscribe()
+        },
+        Benchmark("concatMap", units: events) {
+            _ = range()
+                .concatMap { Observable.just($0) }
+                .subscribe()
+        },
+        Benchmark("merge", units: events * 2) {
+            _ = Observable.merge(range(), range())
+                .subscribe()
+        },
+        Benchmark("combineLatest", units: events * 2) {
+            let first = PublishSubject<Int>()
+            let second = PublishSubject<Int>()
+            let subscription = Observable.combineLatest(first, second).subscribe()
+            for i in 0 ..< events {
+                first.on(.next(i))
+                second.on(.next(i))
+            }
+            subscription.dispose()
+        },
+        Benchmark("zip", units: events * 2) {
+            _ = Observable.zip(range(), range())
+                .subscribe()
+        },
+        Benchmark("distinctUntilChanged", units: events) {
+            _ = range()
+                .map { $0 / 2 }
+                .distinctUntilChanged()
+                .subscribe()
+        },
+        Benchmark("buffer", units: events) {
+            _ = range()
+                .buffer(timeSpan: .seconds(1000), count: 16, scheduler: ConcurrentDispatchQueueScheduler(qos: .default))
+                .subscribe()
+        },
+        Benchmark("share(replay: 1)", units: events * 2) {
+            let shared = range().share(replay: 1)
+            _ = shared.subscribe()
+            _ = shared.subscribe()
+        },
+        Benchmark("frames newline", unit: "frame", units: events) {
+            _ = Observable.from(jsonLineChunks)
+                .frames(.newlineDelimited)
+                .subscribe()
+        },
+        Benchmark("decode", unit: "frame", units: events) {
+            _ = Observable.from(jsonLineChunks)
+                .frames(.newlineDelimited)
+                .decode(type: BenchmarkRecord.self, decoder: JSONDecoder())
+                .subscribe()
+        },
+        Benchmark("decode parallel", unit: "frame", units: events) {
+            waitForTermination(
+                Observable.from(jsonLineChunks)
+                    .frames(.newlineDelimited)
+                    .decode(type: BenchmarkRecord.self, decoder: JSONDecoder(), scheduler: WorkStealingScheduler())
+            )
+        }
+    ]
+}
+
+private struct BenchmarkRecord: Decodable {
+    let id: Int
+    let name: String
+    let tags: [String]
+}
+
+/// `events` JSON lines, cut into chunks that don't line up with the lines.
+private let jsonLineChunks: [Data] = {
+    let lines = (0 ..< events)
+        .map { #"{"id": \#($0), "name": "record \#($0)", "tags": ["a", "b", "c"]}"# + "\n" }
+        .joined()
+    let bytes = Data(lines.utf8)
+    return stride(from: 0, to: bytes.count, by: 4096).map { bytes[$0 ..< min($0 + 4096, bytes.count)] }
+}()
+
+func collectionBenchmarks() -> [Benchmark] {
+    [2, 10, 100, 1000, 10000].flatMap { sourceCount -> [Benchmark] in
+        let rounds = Swift.max(10, events / sourceCount)
+        return [
+            Benchmark("zip \(sourceCount) sources", units: sourceCount * rounds) {
+                let subjects = (0 ..< sourceCount).map { _ in PublishSubject<Int>() }
+                let subscription = Observable.zip(subjects, resultSelector: { $0.count }).subscribe()
+                for i in 0 ..< rounds {
+                    for subject in subjects {
+                        subject.on(.next(i))
+                    }
+                }
+                subscription.dispose()
+            },
+            Benchmark("combineLatest \(sourceCount) sources", units: sourceCount * rounds) {
+                let subjects = (0 ..< sourceCount).map { _ in PublishSubject<Int>() }
+                let subscription = Observable.combineLatest(subjects, resultSelector: { $0.count }).subscribe()
+                for i in 0 ..< rounds {
+                    for subject in subjects {
+                        subject.on(.next(i))
+                    }
+                }
+                subscription.dispose()
+            },
+            // The latest values are updated in place. A selector that keeps them forces a copy of all of them on the
+            // next event, which is what every event cost before they were reused, so the two show what reuse saves.
+            Benchmark("combineLatest \(sourceCount) sources, arguments borrowed", units: sourceCount * rounds) {
+                combineLatestSteadyState(sourceCount: sourceCount, rounds: rounds) { $0.count }
+            },
+            Benchmark("combineLatest \(sourceCount) sources, arguments kept", units: sourceCount * rounds) {
+                var kept = [Int]()
+                combineLatestSteadyState(sourceCount: sourceCount, rounds: rounds) { arguments -> Int in
+                    kept = arguments
+                    return kept.count
+                }
+            }
+        ]
+    }
+}
+
+/// Sends `rounds` events to each of `sourceCount` sources after every source already produced a value.
+private func combineLatestSteadyState(sourceCount: Int, rounds: Int, resultSelector: @escaping ([Int]) -> Int) {
+    let subjects = (0 ..< sourceCount).map { _ in BehaviorSubject(value: 0) }
+    let subscription = Observable.combineLatest(subjects, resultSelector: resultSelector).subscribe()
+    for i in 0 ..< rounds {
+        for subject in subjects {
+            subject.on(.next(i))
+        }
+    }
+    subscription.dispose()
+}
+
+func schedulerBenchmarks() -> [Benchmark] {
+    [
+        Benchmark("CurrentThreadScheduler range", units: events) {
+            _ = Observable.range(start: 0, count: events, scheduler: CurrentThreadScheduler.instance)
+                .subscribe()
+        },
+        Benchmark("observe(on:) serial", units: events) {
+            let scheduler = SerialDispatchQueueScheduler(qos: .default)
+            waitForTermination(range().observe(on: scheduler))
+        },
+        Benchmark("observe(on:) bounded block", units: events) {
+            let scheduler = SerialDispatchQueueScheduler(qos: .default)
+            waitForTermination(range().observe(on: scheduler, bufferSize: 128, overflow: .block))
+        },
+        Benchmark("parallel map", units: events) {
+            let scheduler = WorkStealingScheduler()
+            waitForTermination(
+                range()
+                    .parallel(on: scheduler)
+                    .map { $0 * 2 }
+                    .sequential()
+            )
+        },
+        Benchmark("handoff SerialDispatchQueueScheduler", unit: "handoff", units: handoffs) {
+            handOff(to: SerialDispatchQueueScheduler(qos: .default))
+        },
+        Benchmark("handoff ConcurrentDispatchQueueScheduler", unit: "handoff", units: handoffs) {
+            handOff(to: ConcurrentDispatchQueueScheduler(qos: .default))
+        },
+        Benchmark("timers SerialDispatchQueueScheduler", unit: "timer", units: 1000) {
+            let scheduler = SerialDispatchQueueScheduler(qos: .default)
+            waitForTermination(timers(on: scheduler))
+        },
+        Benchmark("timers TimerWheelScheduler", unit: "timer", units: 1000) {
+            let scheduler = TimerWheelScheduler(internalSerialQueueName: "rxswift.benchmarks.timer_wheel")
+            waitForTermination(timers(on: scheduler))
+        },
+        Benchmark("HistoricalScheduler replay", units: events) {
+            let scheduler = HistoricalScheduler()
+            for i in 0 ..< events {
+                _ = scheduler.scheduleRelative(i, dueTime: .milliseconds(i)) { _ in Disposables.create() }
+            }
+            scheduler.start()
+        }
+    ]
+}
+
+/// Every element schedules and cancels a timer, the last one is allowed to fire.
+private func timers(on scheduler: SchedulerType) -> Observable<Int> {
+    Observable.range(start: 0, count: 1000)
+        .debounce(.milliseconds(1), scheduler: scheduler)
+}
+
+/// Every action is scheduled only after the previous one ran, so this measures the latency of a single hop.
+private func handOff(to scheduler: ImmediateSchedulerType) {
+    let semaphore = DispatchSemaphore(value: 0)
+    for i in 0 ..< handoffs {
+        _ = scheduler.schedule(i) { _ in
+            semaphore.signal()
+            return Disposables.create()
+        }
+        semaphore.wait()
+    }
+}
+
+func subscriptionBenchmarks() -> [Benchmark] {
+    [
+        Benchmark("just", unit: "subscription", units: subscriptions) {
+            for i in 0 ..< subscriptions {
+                _ = Observable.just(i).subscribe()
+            }
+        },
+        Benchmark("map chain", unit: "subscription", units: subscriptions) {
+            for i in 0 ..< subscriptions {
+                _ = Observable.just(i)
+                    .map { $0 + 1 }
+                    .filter { $0 > 0 }
+                    .map { $0 * 2 }
+                    .subscribe()
+            }
+        },
+        // Same as `Benchmarks.testMapFilterCreating`, allocation counts of this one are the ones to watch.
+        Benchmark("map filter creating", unit: "subscription", units: subscriptions) {
+            for _ in 0 ..< subscriptions {
+                Observable<Int>.create { observer in
+                    observer.on(.next(1))
+                    return Disposables.create()
+                }
+                .map(\.self).filter { _ in true }
+                .map(\.self).filter { _ in true }
+                .map(\.self).filter { _ in true }
+                .map(\.self).filter { _ in true }
+                .map(\.self).filter { _ in true }
+                .map(\.self).filter { _ in true }
+                .subscribe(onNext: { _ in })
+                .dispose()
+            }
+        },
+        // Same as `Benchmarks.testPublishSubjectCreating`.
+        Benchmark("PublishSubject creating", unit: "subscription", units: subscriptions) {
+            for _ in 0 ..< subscriptions {
+                let subject = PublishSubject<Int>()
+                let subscription = subject.subscribe(onNext: { _ in })
+                subject.on(.next(1))
+                subscription.dispose()
+            }
+        },
+        Benchmark("subject subscribe dispose", unit: "subscription", units: subscriptions) {
+            let subject = PublishSubject<Int>()
+            for _ in 0 ..< subscriptions {
+                subject.subscribe(onNext: { _ in }).dispose()
+            }
+        },
+        Benchmark("create", unit: "subscription", units: subscriptions) {
+            for i in 0 ..< subscriptions {
+                _ = Observable<Int>.create { observer in
+                    observer.on(.next(i))
+                    observer.on(.completed)
+                    return Disposables.create()
+                }
+                .subscribe()
+            }
+        },
+        Benchmark("Single.just", unit: "subscription", units: subscriptions) {
+            for i in 0 ..< subscriptions {
+                _ = Single.just(i).subscribe()
+            }
+        }
+    ]
+}
+
+func concurrencyBenchmarks() -> [Benchmark] {
+    #if swift(>=5.7)
+    guard #available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *) else {
+        return []
+    }
+
+    return [
+        Benchmark("Observable.values", units: events) {
+            waitForTask {
+                for try await _ in range().values {}
+            }
+        },
+        Benchmark("AsyncStream.asObservable()", units: events) {
+            let stream = AsyncStream<Int> { continuation in
+                for i in 0 ..< events {
+                    continuation.yield(i)
+                }
+                continuation.finish()
+            }
+            waitForTermination(stream.asObservable())
+        },
+        Benchmark("handoff ExecutorScheduler", unit: "handoff", units: handoffs) {
+            handOff(to: ExecutorScheduler())
+        },
+        Benchmark("handoff ExecutorScheduler actor", unit: "handoff", units: handoffs) {
+            handOff(to: ExecutorScheduler(actor: BenchmarkActor()))
+        },
+        Benchmark("observe(on:) ExecutorScheduler", units: events) {
+            waitForTermination(range().observe(on: ExecutorScheduler()))
+        },
+        Benchmark("observe(on:) ExecutorScheduler actor", units: events) {
+            waitForTermination(range().observe(on: ExecutorScheduler(actor: BenchmarkActor())))
+        },
+        Benchmark("Single.value", unit: "subscription", units: subscriptions) {
+            waitForTask {
+                for i in 0 ..< subscriptions {
+                    _ = try await Single.just(i).value
+                }
+            }
+        }
+    ]
+    #else
+    return []
+    #endif
+}
+
+#if swift(>=5.7)
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private actor BenchmarkActor {}
+
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private func waitForTask(_ operation: @escaping @Sendable () async throws -> Void) {
+    let semaphore = DispatchSemaphore(value: 0)
+    Task {
+        try? await operation()
+        semaphore.signal()
+    }
+    semaphore.wait()
+}
+#endif
+
+func allBenchmarks() -> [(suite: String, benchmarks: [Benchmark])] {
+    [
+        (suite: "subjects", benchmarks: subjectBenchmarks()),
+        (suite: "operators", benchmarks: operatorBenchmarks()),
+        (suite: "collections", benchmarks: collectionBenchmarks()),
+        (suite: "schedulers", benchmarks: schedulerBenchmarks()),
+        (suite: "subscriptions", benchmarks: subscriptionBenchmarks()),
+        (suite: "concurrency", benchmarks: concurrencyBenchmarks())
+    ]
+}
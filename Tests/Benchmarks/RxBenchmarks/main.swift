@@ -0,0 +1,105 @@
+//
+//  main.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+
+// Usage: RxBenchmarks [--filter <substring>] [--repetitions <n>] [--json <path>] [--baseline <path>] [--tolerance <fraction>]
+//
+// Runs all benchmarks whose suite or name contains the filter, prints the results and optionally writes them
+// as JSON. When a baseline written by a previous run is passed, exits with a non zero status if any benchmark regressed.
+
+struct Options {
+    var filter: String?
+    var repetitions = 5
+    var jsonPath: String?
+    var baselinePath: String?
+    var tolerance = 0.1
+}
+
+func fail(_ message: String) -> Never {
+    FileHandle.standardError.write((message + "\n").data(using: .utf8)!)
+    exit(2)
+}
+
+func parseOptions(_ arguments: [String]) -> Options {
+    var options = Options()
+    var iterator = arguments.makeIterator()
+
+    func value(for flag: String) -> String {
+        guard let value = iterator.next() else {
+            fail("Missing value for \(flag)")
+        }
+        return value
+    }
+
+    while let argument = iterator.next() {
+        switch argument {
+        case "--filter":
+            options.filter = value(for: argument)
+        case "--repetitions":
+            guard let repetitions = Int(value(for: argument)), repetitions > 0 else {
+                fail("--repetitions must be a positive integer")
+            }
+            options.repetitions = repetitions
+        case "--json":
+            options.jsonPath = value(for: argument)
+        case "--baseline":
+            options.baselinePath = value(for: argument)
+        case "--tolerance":
+            guard let tolerance = Double(value(for: argument)), tolerance >= 0 else {
+                fail("--tolerance must be a non negative number")
+            }
+            options.tolerance = tolerance
+        default:
+            fail("Unknown argument \(argument)")
+        }
+    }
+
+    return options
+}
+
+let options = parseOptions(Array(CommandLine.arguments.dropFirst()))
+let runner = BenchmarkRunner(repetitions: options.repetitions)
+
+var results = [BenchmarkResult]()
+for (suite, benchmarks) in allBenchmarks() {
+    for benchmark in benchmarks {
+        if let filter = options.filter, !suite.contains(filter), !benchmark.name.contains(filter) {
+            continue
+        }
+        results.append(runner.run(benchmark))
+    }
+}
+
+printTable(results)
+
+if let jsonPath = options.jsonPath {
+    let encoder = JSONEncoder()
+    encoder.outputFormatting = .prettyPrinted
+    do {
+        try encoder.encode(results).write(to: URL(fileURLWithPath: jsonPath))
+    } catch {
+        fail("Writing \(jsonPath) failed: \(error)")
+    }
+}
+
+if let baselinePath = options.baselinePath {
+    let baseline: [BenchmarkResult]
+    do {
+        baseline = try JSONDecoder().decode([BenchmarkResult].self, from: Data(contentsOf: URL(fileURLWithPath: baselinePath)))
+    } catch {
+        fail("Reading \(baselinePath) failed: \(error)")
+    }
+
+    let found = regressions(of: results, against: baseline, timeTolerance: options.tolerance)
+    if !found.isEmpty {
+        print("\nRegressions against \(baselinePath):")
+        found.forEach { print("  \($0)") }
+        exit(1)
+    }
+}
@@ -0,0 +1,155 @@
+//
+//  RxMallocCounter.c
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#include "RxMallocCounter.h"
+
+#include <errno.h>
+#include <stddef.h>
+
+static uint64_t allocations = 0;
+static uint64_t bytes = 0;
+static bool counting = false;
+
+static inline void count_allocation(size_t size) {
+    if (__atomic_load_n(&counting, __ATOMIC_RELAXED)) {
+        __atomic_fetch_add(&allocations, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&bytes, size, __ATOMIC_RELAXED);
+    }
+}
+
+void rx_malloc_counter_stop(void) {
+    __atomic_store_n(&counting, false, __ATOMIC_RELAXED);
+}
+
+uint64_t rx_malloc_counter_allocations(void) {
+    return __atomic_load_n(&allocations, __ATOMIC_RELAXED);
+}
+
+uint64_t rx_malloc_counter_bytes(void) {
+    return __atomic_load_n(&bytes, __ATOMIC_RELAXED);
+}
+
+#if defined(__APPLE__)
+
+#include <malloc/malloc.h>
+#include <mach/mach.h>
+
+// Darwin uses two-level namespaces, so `malloc` can't be interposed from an executable.
+// Hook the default zone instead, the same way `Tests/Microoptimizations` does.
+
+static void *(*original_malloc)(struct _malloc_zone_t *, size_t);
+static void *(*original_calloc)(struct _malloc_zone_t *, size_t, size_t);
+static void *(*original_realloc)(struct _malloc_zone_t *, void *, size_t);
+static void *(*original_memalign)(struct _malloc_zone_t *, size_t, size_t);
+
+static void *counting_malloc(struct _malloc_zone_t *zone, size_t size) {
+    count_allocation(size);
+    return original_malloc(zone, size);
+}
+
+static void *counting_calloc(struct _malloc_zone_t *zone, size_t count, size_t size) {
+    count_allocation(count * size);
+    return original_calloc(zone, count, size);
+}
+
+static void *counting_realloc(struct _malloc_zone_t *zone, void *pointer, size_t size) {
+    count_allocation(size);
+    return original_realloc(zone, pointer, size);
+}
+
+static void *counting_memalign(struct _malloc_zone_t *zone, size_t alignment, size_t size) {
+    count_allocation(size);
+    return original_memalign(zone, alignment, size);
+}
+
+bool rx_malloc_counter_start(void) {
+    if (original_malloc == NULL) {
+        malloc_zone_t *zone = malloc_default_zone();
+        vm_address_t page = (vm_address_t)zone & ~(vm_page_size - 1);
+        vm_size_t size = ((vm_address_t)zone + sizeof(malloc_zone_t) - page + vm_page_size - 1) & ~(vm_page_size - 1);
+
+        if (vm_protect(mach_task_self(), page, size, 0, VM_PROT_READ | VM_PROT_WRITE) != KERN_SUCCESS) {
+            return false;
+        }
+
+        original_malloc = zone->malloc;
+        original_calloc = zone->calloc;
+        original_realloc = zone->realloc;
+        zone->malloc = counting_malloc;
+        zone->calloc = counting_calloc;
+        zone->realloc = counting_realloc;
+        if (zone->version >= 5 && zone->memalign != NULL) {
+            original_memalign = zone->memalign;
+            zone->memalign = counting_memalign;
+        }
+
+        vm_protect(mach_task_self(), page, size, 0, VM_PROT_READ);
+    }
+
+    __atomic_store_n(&counting, true, __ATOMIC_RELAXED);
+    return true;
+}
+
+#elif defined(__GLIBC__)
+
+// Symbols defined in the executable take precedence over the ones in libc, including for calls
+// made from shared libraries like the Swift runtime. glibc exports the real implementations
+// under `__libc_*` names.
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size) {
+    count_allocation(size);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    count_allocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+    count_allocation(size);
+    return __libc_realloc(pointer, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    count_allocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+    count_allocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+    count_allocation(size);
+    void *pointer = __libc_memalign(alignment, size);
+    if (pointer == NULL) {
+        return ENOMEM;
+    }
+    *result = pointer;
+    return 0;
+}
+
+bool rx_malloc_counter_start(void) {
+    __atomic_store_n(&counting, true, __ATOMIC_RELAXED);
+    return true;
+}
+
+#else
+
+bool rx_malloc_counter_start(void) {
+    return false;
+}
+
+#endif
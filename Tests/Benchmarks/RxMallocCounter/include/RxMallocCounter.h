@@ -0,0 +1,29 @@
+//
+//  RxMallocCounter.h
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#ifndef RxMallocCounter_h
+#define RxMallocCounter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Starts counting heap allocations of the whole process.
+///
+/// Returns `false` if allocations can't be counted on this platform.
+bool rx_malloc_counter_start(void);
+
+/// Stops counting heap allocations, counters keep their values.
+void rx_malloc_counter_stop(void);
+
+/// Number of counted allocations.
+uint64_t rx_malloc_counter_allocations(void);
+
+/// Number of counted requested bytes.
+uint64_t rx_malloc_counter_bytes(void);
+
+#endif /* RxMallocCounter_h */
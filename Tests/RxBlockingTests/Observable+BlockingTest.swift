@@ -380,3 +380,94 @@ extension ObservableBlockingTest {
         }
     }
 }
+
+// condition wait strategy
+
+extension ObservableBlockingTest {
+    func testConditionToArray_someData() {
+        XCTAssertEqual(try Observable.of(42, 43, 44, 45).toBlocking(waitStrategy: .condition).toArray(), [42, 43, 44, 45])
+    }
+
+    func testConditionToArray_withRealScheduler() {
+        let scheduler = ConcurrentDispatchQueueScheduler(qos: .default)
+
+        let array = try! Observable<Int64>.interval(.milliseconds(1), scheduler: scheduler)
+            .take(10)
+            .toBlocking(waitStrategy: .condition)
+            .toArray()
+
+        XCTAssertEqual(array, Array(0 ..< 10))
+    }
+
+    func testConditionFirst_withRealScheduler() {
+        let scheduler = ConcurrentDispatchQueueScheduler(qos: .default)
+
+        let element = try! Observable.of(1, 2)
+            .subscribe(on: scheduler)
+            .toBlocking(waitStrategy: .condition)
+            .first()
+
+        XCTAssertEqual(element, 1)
+    }
+
+    func testConditionToArray_fail() {
+        XCTAssertThrowsErrorEqual(try Observable<Int>.error(testError).toBlocking(waitStrategy: .condition).toArray(), testError)
+    }
+
+    func testConditionToArray_timeout() {
+        XCTAssertThrowsError(try Observable<Int>.never().toBlocking(timeout: 0.01, waitStrategy: .condition).toArray()) { error in
+            XCTAssertErrorEqual(error, RxError.timeout)
+        }
+    }
+}
+
+// iterator
+
+extension ObservableBlockingTest {
+    func testIterator_someData() {
+        let iterator = Observable.range(start: 0, count: 10000).toBlocking().iterator(bufferSize: 4)
+
+        var elements = [Int]()
+        while let element = try! iterator.next() {
+            elements.append(element)
+        }
+
+        XCTAssertEqual(elements, Array(0 ..< 10000))
+        XCTAssertNil(try iterator.next())
+    }
+
+    func testIterator_fail() {
+        let sequence = Observable.concat(Observable.of(42, 43), Observable<Int>.error(testError))
+        let iterator = sequence.toBlocking().iterator(bufferSize: 1)
+
+        XCTAssertEqual(try iterator.next(), 42)
+        XCTAssertEqual(try iterator.next(), 43)
+        XCTAssertThrowsErrorEqual(try iterator.next(), testError)
+        XCTAssertNil(try iterator.next())
+    }
+
+    func testIterator_boundsProducer() {
+        let produced = AtomicInt(0)
+        let iterator = Observable.range(start: 0, count: 10000)
+            .do(onNext: { _ in _ = increment(produced) })
+            .toBlocking()
+            .iterator(bufferSize: 8)
+
+        XCTAssertEqual(try iterator.next(), 0)
+        Thread.sleep(forTimeInterval: 0.05)
+
+        // The pulled element, the buffer and the element that is blocked on the full buffer.
+        XCTAssertLessThanOrEqual(load(produced), 10)
+
+        iterator.dispose()
+        XCTAssertNil(try iterator.next())
+    }
+
+    func testIterator_timeout() {
+        let iterator = Observable<Int>.never().toBlocking(timeout: 0.01).iterator()
+
+        XCTAssertThrowsError(try iterator.next()) { error in
+            XCTAssertErrorEqual(error, RxError.timeout)
+        }
+    }
+}
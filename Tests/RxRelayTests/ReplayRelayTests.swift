@@ -110,4 +110,25 @@ class ReplayRelayTests: RxTest {
 
         scheduler.start()
     }
+
+    func test_timeWindow() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        var relay: ReplayRelay<Int>! = nil
+        let result = scheduler.createObserver(Int.self)
+
+        scheduler.scheduleAt(100) { relay = ReplayRelay.create(bufferSize: 3, window: .seconds(100), scheduler: scheduler) }
+        scheduler.scheduleAt(150) { relay.accept(1) }
+        scheduler.scheduleAt(200) { relay.accept(2) }
+        scheduler.scheduleAt(250) { relay.accept(3) }
+        scheduler.scheduleAt(260) { relay.accept(4) }
+        scheduler.scheduleAt(300) { _ = relay.subscribe(result) }
+
+        scheduler.start()
+
+        XCTAssertEqual(result.events, [
+            .next(300, 3),
+            .next(300, 4)
+        ])
+    }
 }
@@ -200,6 +200,59 @@ extension BagTest {
         XCTAssertTrue(numberDisposables == 0)
     }
 
+    func testBag_enumeratesInInsertionOrder() {
+        var bag = Bag<Int>()
+
+        var keys = [KeyType]()
+        for i in 0 ..< 100 {
+            keys.append(bag.insert(i))
+        }
+
+        for i in stride(from: 0, to: 100, by: 3) {
+            XCTAssertEqual(bag.removeKey(keys[i]), i)
+        }
+
+        for i in 100 ..< 150 {
+            keys.append(bag.insert(i))
+        }
+
+        var expected = (0 ..< 150).filter { $0 >= 100 || $0 % 3 != 0 }
+        var enumerated = [Int]()
+        bag.forEach { enumerated.append($0) }
+
+        XCTAssertEqual(enumerated, expected)
+        XCTAssertEqual(bag.count, expected.count)
+
+        for i in 0 ..< 140 where i % 3 != 0 || i >= 100 {
+            XCTAssertEqual(bag.removeKey(keys[i]), i)
+        }
+
+        expected = Array(140 ..< 150)
+        enumerated = []
+        bag.forEach { enumerated.append($0) }
+
+        XCTAssertEqual(enumerated, expected)
+        XCTAssertEqual(bag.count, expected.count)
+    }
+
+    func testBag_staleKeyDoesntRemoveReusedSlot() {
+        var bag = Bag<Int>()
+
+        let key0 = bag.insert(0)
+        let key1 = bag.insert(1)
+
+        XCTAssertEqual(bag.removeKey(key1), 1)
+        let key2 = bag.insert(2)
+
+        XCTAssertNil(bag.removeKey(key1))
+        XCTAssertEqual(bag.count, 2)
+
+        XCTAssertEqual(bag.removeKey(key0), 0)
+        XCTAssertNil(bag.removeKey(key0))
+        XCTAssertEqual(bag.removeKey(key2), 2)
+        XCTAssertEqual(bag.count, 0)
+    }
+
     func testBag_complexityTestFromFront() {
         var bag = Bag<Disposable>()
 
@@ -6,6 +6,7 @@
 //  Copyright © 2015 Krunoslav Zaher. All rights reserved.
 //
 
+import Dispatch
 import RxSwift
 import XCTest
 
@@ -92,4 +93,71 @@ extension CurrentThreadSchedulerTest {
 
         XCTAssertEqual(messages, [1, 2])
     }
+
+    func testCurrentThreadScheduler_reusesTrampolineAfterDraining() {
+        var messages = [Int]()
+
+        for iteration in 0 ..< 3 {
+            XCTAssertTrue(CurrentThreadScheduler.isScheduleRequired)
+            _ = CurrentThreadScheduler.instance.schedule(()) { _ in
+                XCTAssertFalse(CurrentThreadScheduler.isScheduleRequired)
+                _ = CurrentThreadScheduler.instance.schedule(()) { _ in
+                    messages.append(iteration * 10 + 2)
+                    return Disposables.create()
+                }
+                messages.append(iteration * 10 + 1)
+                return Disposables.create()
+            }
+        }
+
+        XCTAssertTrue(CurrentThreadScheduler.isScheduleRequired)
+        XCTAssertEqual(messages, [1, 2, 11, 12, 21, 22])
+    }
+
+    func testCurrentThreadScheduler_trampolineIsPerThread() {
+        let expectation = self.expectation(description: "background trampoline")
+
+        _ = CurrentThreadScheduler.instance.schedule(()) { _ in
+            XCTAssertFalse(CurrentThreadScheduler.isScheduleRequired)
+
+            DispatchQueue.global(qos: .default).async {
+                XCTAssertTrue(CurrentThreadScheduler.isScheduleRequired)
+                var executed = false
+                _ = CurrentThreadScheduler.instance.schedule(()) { _ in
+                    executed = true
+                    return Disposables.create()
+                }
+                XCTAssertTrue(executed)
+                expectation.fulfill()
+            }
+
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0)
+    }
+
+    func testCurrentThreadScheduler_sourcesInterleaveWithQueuedWork() {
+        var elements = [Int]()
+
+        _ = Observable.of(1, 2)
+            .flatMap { Observable.of($0 * 10, $0 * 10 + 1) }
+            .subscribe(onNext: { elements.append($0) })
+
+        XCTAssertEqual(elements, [10, 11, 20, 21])
+    }
+
+    func testCurrentThreadScheduler_sourceLoopStopsOnDispose() {
+        var iterations = 0
+
+        var elements = [Int]()
+
+        _ = Observable
+            .generate(initialState: 0, condition: { _ in true }, iterate: { iterations += 1; return $0 + 1 })
+            .take(3)
+            .subscribe(onNext: { elements.append($0) })
+
+        XCTAssertEqual(elements, [0, 1, 2])
+        XCTAssertEqual(iterations, 2)
+    }
 }
@@ -0,0 +1,231 @@
+//
+//  ExecutorSchedulerTests.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+#if swift(>=5.7)
+import Dispatch
+import Foundation
+import RxSwift
+import XCTest
+
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+final class ExecutorSchedulerTests: RxTest {}
+
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+private actor ExecutorSchedulerTestActor {}
+
+@available(macOS 10.15, iOS 13.0, watchOS 6.0, tvOS 13.0, *)
+extension ExecutorSchedulerTests {
+    func test_scheduleIsSerialAndOrdered() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let fired = Synchronized([Int]())
+        let running = Synchronized(0)
+        let overlapped = Synchronized(false)
+
+        for i in 0 ..< 1000 {
+            _ = scheduler.schedule(i) { value -> Disposable in
+                let isAlone = running.mutate { running -> Bool in
+                    running += 1
+                    return running == 1
+                }
+                if !isAlone {
+                    overlapped.mutate { $0 = true }
+                }
+                fired.mutate { $0.append(value) }
+                running.mutate { $0 -= 1 }
+                if value == 999 {
+                    expectScheduling.fulfill()
+                }
+                return Disposables.create()
+            }
+        }
+
+        waitForExpectations(timeout: 5.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, Array(0 ..< 1000))
+        XCTAssertFalse(overlapped.value)
+    }
+
+    func test_scheduleCancel() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let gate = DispatchSemaphore(value: 0)
+        let fired = Synchronized([Int]())
+
+        // Keep the scheduler busy so the cancelled action is still queued.
+        _ = scheduler.schedule(()) { _ -> Disposable in
+            gate.wait()
+            return Disposables.create()
+        }
+
+        let disposable = scheduler.schedule(1) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            return Disposables.create()
+        }
+        _ = scheduler.schedule(2) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        disposable.dispose()
+        gate.signal()
+
+        waitForExpectations(timeout: 2.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, [2])
+    }
+
+    func test_scheduleRelative() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let start = Date()
+
+        var interval = 0.0
+
+        _ = scheduler.scheduleRelative(1, dueTime: .milliseconds(100)) { _ -> Disposable in
+            interval = Date().timeIntervalSince(start)
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(interval, 0.1, accuracy: 0.1)
+    }
+
+    func test_scheduleRelativeCancel() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let fired = Synchronized(false)
+
+        let disposable = scheduler.scheduleRelative(1, dueTime: .milliseconds(100)) { _ -> Disposable in
+            fired.mutate { $0 = true }
+            return Disposables.create()
+        }
+
+        disposable.dispose()
+
+        DispatchQueue.global().asyncAfter(deadline: .now() + .milliseconds(300)) {
+            expectScheduling.fulfill()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertFalse(fired.value)
+    }
+
+    func test_scheduleRelativeSaturatesFarFuture() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let fired = Synchronized([Int]())
+
+        // Doesn't fit into `Int64` nanoseconds, nor into an uptime deadline.
+        let farFuture = scheduler.scheduleRelative(1, dueTime: .seconds(Int.max)) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            return Disposables.create()
+        }
+
+        let periodic = scheduler.schedulePeriodic(2, startAfter: .milliseconds(10), period: .seconds(Int.max)) { value -> Int in
+            fired.mutate { $0.append(value) }
+            expectScheduling.fulfill()
+            return value
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        farFuture.dispose()
+        periodic.dispose()
+
+        XCTAssertEqual(fired.value, [2])
+    }
+
+    func test_schedulePeriodic() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let start = Date()
+        let times = Synchronized([Date]())
+
+        let disposable = scheduler.schedulePeriodic(0, startAfter: .milliseconds(200), period: .milliseconds(300)) { state -> Int in
+            times.mutate { $0.append(Date()) }
+            if state == 1 {
+                expectScheduling.fulfill()
+            }
+            return state + 1
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        disposable.dispose()
+
+        XCTAssertEqual(times.value.count, 2)
+        XCTAssertEqual(times.value[0].timeIntervalSince(start), 0.2, accuracy: 0.1)
+        XCTAssertEqual(times.value[1].timeIntervalSince(start), 0.5, accuracy: 0.2)
+    }
+
+    func test_schedulePeriodicCancel() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = ExecutorScheduler()
+        let fired = Synchronized(0)
+
+        let disposable = scheduler.schedulePeriodic(0, startAfter: .milliseconds(200), period: .milliseconds(300)) { state -> Int in
+            fired.mutate { $0 += 1 }
+            return state + 1
+        }
+
+        disposable.dispose()
+
+        DispatchQueue.global().asyncAfter(deadline: .now() + .milliseconds(300)) {
+            expectScheduling.fulfill()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, 0)
+    }
+
+    func test_observeOnActor() async {
+        let actor = ExecutorSchedulerTestActor()
+        let scheduler = ExecutorScheduler(actor: actor)
+
+        let received = try? await Observable.range(start: 0, count: 1000)
+            .observe(on: scheduler)
+            .toArray()
+            .value
+
+        XCTAssertEqual(received, Array(0 ..< 1000))
+    }
+
+    func test_subscribeOnActor() async {
+        let actor = ExecutorSchedulerTestActor()
+        let scheduler = ExecutorScheduler(actor: actor)
+
+        let received = try? await Observable.range(start: 0, count: 10)
+            .subscribe(on: scheduler)
+            .observe(on: scheduler)
+            .toArray()
+            .value
+
+        XCTAssertEqual(received, Array(0 ..< 10))
+    }
+}
+#endif
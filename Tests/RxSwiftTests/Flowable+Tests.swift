@@ -0,0 +1,272 @@
+//
+//  Flowable+Tests.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import RxBlocking
+import RxSwift
+import RxTest
+import XCTest
+
+class FlowableTest: RxTest {}
+
+/// Subscriber that records events and only requests elements when told to.
+private final class RequestingSubscriber<Element>: FlowSubscriberType {
+    var subscription: FlowSubscription?
+    var events: [Event<Element>] = []
+
+    var elements: [Element] {
+        events.compactMap(\.element)
+    }
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        self.subscription = subscription
+    }
+
+    func on(_ event: Event<Element>) {
+        events.append(event)
+    }
+
+    func request(_ count: Int) {
+        subscription!.request(count)
+    }
+}
+
+extension FlowableTest {
+    func testFrom_EmitsOnlyRequestedElements() {
+        let subscriber = RequestingSubscriber<Int>()
+        Flowable.from(1 ... 5).subscribe(subscriber)
+
+        XCTAssertEqual(subscriber.elements, [])
+
+        subscriber.request(2)
+        XCTAssertEqual(subscriber.elements, [1, 2])
+
+        subscriber.request(10)
+        XCTAssertEqual(subscriber.elements, [1, 2, 3, 4, 5])
+        XCTAssertTrue(subscriber.events.last!.isCompleted)
+    }
+
+    func testFrom_CompletesWithoutDemand() {
+        let subscriber = RequestingSubscriber<Int>()
+        Flowable.from([Int]()).subscribe(subscriber)
+
+        XCTAssertEqual(subscriber.events.count, 1)
+        XCTAssertTrue(subscriber.events[0].isCompleted)
+    }
+
+    func testFrom_Dispose() {
+        let subscriber = RequestingSubscriber<Int>()
+        Flowable.from(1 ... 5).subscribe(subscriber)
+
+        subscriber.request(1)
+        subscriber.subscription!.dispose()
+        subscriber.request(10)
+
+        XCTAssertEqual(subscriber.elements, [1])
+        XCTAssertEqual(subscriber.events.count, 1)
+    }
+
+    func testMapFilter_PropagateDemand() {
+        var pulled = [Int]()
+        let subscriber = RequestingSubscriber<Int>()
+
+        Flowable.from((1 ... 10).lazy.map { element -> Int in
+            pulled.append(element)
+            return element
+        })
+        .filter { $0 % 2 == 0 }
+        .map { $0 * 10 }
+        .subscribe(subscriber)
+
+        subscriber.request(2)
+
+        XCTAssertEqual(subscriber.elements, [20, 40])
+        XCTAssertEqual(pulled, [1, 2, 3, 4, 5])
+    }
+
+    func testMap_Error() {
+        let subscriber = RequestingSubscriber<Int>()
+
+        Flowable.from(1 ... 5)
+            .map { element -> Int in
+                if element == 2 {
+                    throw testError
+                }
+                return element
+            }
+            .subscribe(subscriber)
+
+        subscriber.request(10)
+
+        XCTAssertEqual(subscriber.elements, [1])
+        XCTAssertEqual(subscriber.events.count, 2)
+        XCTAssertNotNil(subscriber.events.last!.error)
+    }
+
+    func testAsObservable_RequestsEverything() {
+        XCTAssertEqual(try Flowable.from(1 ... 5).map { $0 * 2 }.asObservable().toArray().toBlocking().first(), [2, 4, 6, 8, 10])
+    }
+}
+
+// MARK: toFlowable
+
+extension FlowableTest {
+    private func toFlowable(_ strategy: BackpressureStrategy, request: Int) -> [Event<Int>] {
+        let subject = PublishSubject<Int>()
+        let subscriber = RequestingSubscriber<Int>()
+        subject.toFlowable(strategy).subscribe(subscriber)
+
+        subscriber.request(1)
+        for element in 1 ... 5 {
+            subject.onNext(element)
+        }
+        subject.onCompleted()
+        subscriber.request(request)
+
+        return subscriber.events
+    }
+
+    func testToFlowable_Drop() {
+        XCTAssertEqual(toFlowable(.drop, request: 10), [.next(1), .completed])
+    }
+
+    func testToFlowable_Latest() {
+        XCTAssertEqual(toFlowable(.latest, request: 10), [.next(1), .next(5), .completed])
+    }
+
+    func testToFlowable_BufferDropOldest() {
+        XCTAssertEqual(toFlowable(.buffer(size: 2, overflow: .dropOldest), request: 10), [.next(1), .next(4), .next(5), .completed])
+    }
+
+    func testToFlowable_BufferDropNewest() {
+        XCTAssertEqual(toFlowable(.buffer(size: 2, overflow: .dropNewest), request: 10), [.next(1), .next(2), .next(3), .completed])
+    }
+
+    func testToFlowable_BufferError() {
+        XCTAssertEqual(toFlowable(.buffer(size: 2, overflow: .error), request: 10), [.next(1), .error(RxError.bufferOverflow)])
+    }
+
+    func testToFlowable_CompletionWaitsForBufferedElements() {
+        XCTAssertEqual(toFlowable(.buffer(size: 10, overflow: .error), request: 2), [.next(1), .next(2), .next(3)])
+    }
+
+    func testToFlowable_BufferBlock() {
+        let subscriber = RequestingSubscriber<Int>()
+        let done = expectation(description: "done")
+
+        Observable.from(Array(1 ... 100), scheduler: ConcurrentDispatchQueueScheduler(qos: .default))
+            .toFlowable(.buffer(size: 1, overflow: .block))
+            .observe(on: MainScheduler.instance, bufferSize: 4)
+            .subscribe(ClosureSubscriber { subscription, event in
+                subscriber.on(event)
+                if event.isStopEvent {
+                    done.fulfill()
+                } else {
+                    subscription.request(1)
+                }
+            })
+
+        waitForExpectations(timeout: 5)
+        XCTAssertEqual(subscriber.elements, Array(1 ... 100))
+    }
+}
+
+// MARK: flatMap
+
+extension FlowableTest {
+    func testFlatMap_LimitsConcurrencyAndDemand() {
+        var subscribed = 0
+        let subscriber = RequestingSubscriber<Int>()
+
+        Flowable.from(0 ..< 4)
+            .flatMap(maxConcurrency: 2) { element -> Flowable<Int> in
+                subscribed += 1
+                return Flowable.from((0 ..< 3).map { element * 10 + $0 })
+            }
+            .subscribe(subscriber)
+
+        XCTAssertEqual(subscribed, 2)
+        XCTAssertEqual(subscriber.elements, [])
+
+        subscriber.request(3)
+        XCTAssertEqual(subscriber.elements.count, 3)
+
+        subscriber.request(100)
+        XCTAssertEqual(subscribed, 4)
+        XCTAssertEqual(subscriber.elements.sorted(), [0, 1, 2, 10, 11, 12, 20, 21, 22, 30, 31, 32])
+        XCTAssertTrue(subscriber.events.last!.isCompleted)
+    }
+
+    func testFlatMap_InnerError() {
+        let subscriber = RequestingSubscriber<Int>()
+
+        Flowable.from(0 ..< 4)
+            .flatMap(maxConcurrency: 2) { element -> Flowable<Int> in
+                if element == 1 {
+                    return Observable<Int>.error(testError).toFlowable(.drop)
+                }
+                return Flowable.from([element])
+            }
+            .subscribe(subscriber)
+
+        subscriber.request(100)
+
+        XCTAssertNotNil(subscriber.events.last!.error)
+        XCTAssertEqual(subscriber.events.filter(\.isStopEvent).count, 1)
+    }
+}
+
+// MARK: observe(on:)
+
+extension FlowableTest {
+    func testObserveOn_RequestsAtMostBufferSizeAhead() {
+        var pulled = 0
+        let scheduler = TestScheduler(initialClock: 0)
+        let subscriber = RequestingSubscriber<Int>()
+
+        Flowable.from((0 ..< 100).lazy.map { element -> Int in
+            pulled += 1
+            return element
+        })
+        .observe(on: scheduler, bufferSize: 8)
+        .subscribe(subscriber)
+
+        // `bufferSize` elements, plus one pulled ahead by `from` to detect completion
+        XCTAssertEqual(pulled, 9)
+
+        subscriber.request(3)
+        scheduler.start()
+
+        XCTAssertEqual(subscriber.elements, [0, 1, 2])
+        XCTAssertEqual(pulled, 9)
+
+        subscriber.request(100)
+        scheduler.start()
+
+        XCTAssertEqual(subscriber.elements, Array(0 ..< 100))
+        XCTAssertTrue(subscriber.events.last!.isCompleted)
+    }
+}
+
+/// Subscriber that requests one element on subscription and forwards events with the subscription.
+private final class ClosureSubscriber<Element>: FlowSubscriberType {
+    private let handler: (FlowSubscription, Event<Element>) -> Void
+    private var subscription: FlowSubscription?
+
+    init(_ handler: @escaping (FlowSubscription, Event<Element>) -> Void) {
+        self.handler = handler
+    }
+
+    func onSubscribe(_ subscription: FlowSubscription) {
+        self.subscription = subscription
+        subscription.request(1)
+    }
+
+    func on(_ event: Event<Element>) {
+        handler(subscription!, event)
+    }
+}
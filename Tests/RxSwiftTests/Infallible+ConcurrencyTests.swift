@@ -31,5 +31,20 @@ extension InfallibleConcurrencyTests {
 
         XCTAssertEqual(values, Array(1 ... 10))
     }
+
+    func testValuesBufferingNewest() async {
+        let subject = PublishSubject<Int>()
+        let infallible = subject.asInfallible(onErrorJustReturn: 0)
+        var iterator = infallible.values(bufferingPolicy: .bufferingNewest(1)).makeAsyncIterator()
+
+        subject.onNext(1)
+        subject.onNext(2)
+        subject.onCompleted()
+
+        let first = await iterator.next()
+        let end = await iterator.next()
+        XCTAssertEqual(first, 2)
+        XCTAssertNil(end)
+    }
 }
 #endif
@@ -0,0 +1,170 @@
+//
+//  MetricsTest.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import RxBlocking
+import RxSwift
+import RxTest
+import XCTest
+
+final class MetricsTest: RxTest {
+    override func tearDown() {
+        Metrics.isEnabled = false
+        super.tearDown()
+    }
+
+    private func entry(_ name: String, _ operatorName: String) -> OperatorMetricsSnapshot? {
+        Metrics.snapshot().first { $0.name == name && $0.operatorName == operatorName }
+    }
+
+    func testDisabled_registersNothing() {
+        let subject = PublishSubject<Int>()
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let subscription = subject
+            .observe(on: scheduler)
+            .instrument("MetricsTest.disabled")
+            .subscribe()
+
+        subject.on(.next(1))
+        scheduler.start()
+        subscription.dispose()
+
+        XCTAssertTrue(Metrics.snapshot().allSatisfy { $0.name != "MetricsTest.disabled" })
+    }
+
+    func testInstrument_observeOnReportsEventsAndBufferDepth() {
+        Metrics.isEnabled = true
+
+        let subject = PublishSubject<Int>()
+        let scheduler = TestScheduler(initialClock: 0)
+        let observer = scheduler.createObserver(Int.self)
+
+        let subscription = subject
+            .observe(on: scheduler)
+            .instrument("MetricsTest.observeOn")
+            .subscribe(observer)
+
+        subject.on(.next(1))
+        subject.on(.next(2))
+        subject.on(.next(3))
+
+        let buffering = entry("MetricsTest.observeOn", "observeOn")
+        XCTAssertEqual(buffering?.eventsIn, 3)
+        XCTAssertEqual(buffering?.eventsOut, 0)
+        XCTAssertEqual(buffering?.bufferDepth, 3)
+        XCTAssertEqual(buffering?.liveSubscriptions, 1)
+
+        scheduler.start()
+
+        let drained = entry("MetricsTest.observeOn", "observeOn")
+        XCTAssertEqual(drained?.eventsOut, 3)
+        XCTAssertEqual(drained?.bufferDepth, 0)
+        XCTAssertEqual(drained?.peakBufferDepth, 3)
+
+        let instrumented = entry("MetricsTest.observeOn", "instrument")
+        XCTAssertEqual(instrumented?.eventsIn, 3)
+        XCTAssertEqual(instrumented?.subscriptions, 1)
+        XCTAssertEqual(instrumented?.liveSubscriptions, 1)
+
+        subscription.dispose()
+
+        let disposed = entry("MetricsTest.observeOn", "instrument")
+        XCTAssertEqual(disposed?.liveSubscriptions, 0)
+        XCTAssertEqual(disposed?.disposals, 1)
+        XCTAssertEqual(observer.events.count, 3)
+    }
+
+    func testInstrument_countsOnlyElements() throws {
+        Metrics.isEnabled = true
+
+        let scheduler = TestScheduler(initialClock: 0)
+        let source = Observable.from([1, 2, 3])
+
+        _ = source
+            .observe(on: scheduler)
+            .instrument("MetricsTest.elements.observeOn")
+            .subscribe()
+
+        _ = source
+            .observe(on: scheduler, bufferSize: 8, overflow: .error)
+            .instrument("MetricsTest.elements.observeOnBuffered")
+            .subscribe()
+
+        _ = source
+            .delay(.seconds(10), scheduler: scheduler)
+            .instrument("MetricsTest.elements.delay")
+            .subscribe()
+
+        _ = source
+            .concatMap { Observable.of($0, $0) }
+            .instrument("MetricsTest.elements.mergeLimited")
+            .subscribe()
+
+        scheduler.start()
+
+        _ = try source
+            .observe(on: SerialDispatchQueueScheduler(qos: .default))
+            .instrument("MetricsTest.elements.observeOnSerial")
+            .toBlocking()
+            .toArray()
+
+        let expected = [
+            ("MetricsTest.elements.observeOn", "observeOn", 3),
+            ("MetricsTest.elements.observeOnBuffered", "observeOn", 3),
+            ("MetricsTest.elements.delay", "delay", 3),
+            ("MetricsTest.elements.mergeLimited", "mergeLimited", 6),
+            ("MetricsTest.elements.observeOnSerial", "observeOn", 3)
+        ]
+
+        for (name, operatorName, count) in expected {
+            let completed = entry(name, operatorName)
+            XCTAssertEqual(completed?.eventsIn, Int64(count), name)
+            XCTAssertEqual(completed?.eventsOut, Int64(count), name)
+        }
+    }
+
+    func testInstrument_innermostNameWins() {
+        Metrics.isEnabled = true
+
+        let subject = PublishSubject<Int>()
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let subscription = subject
+            .observe(on: scheduler)
+            .instrument("MetricsTest.inner")
+            .observe(on: scheduler)
+            .instrument("MetricsTest.outer")
+            .subscribe()
+
+        XCTAssertEqual(entry("MetricsTest.inner", "observeOn")?.liveSubscriptions, 1)
+        XCTAssertEqual(entry("MetricsTest.outer", "observeOn")?.liveSubscriptions, 1)
+
+        subscription.dispose()
+    }
+
+    func testTagging_replaySubjectReportsBufferDepth() {
+        Metrics.isEnabled = true
+
+        let subject = Metrics.tagging("MetricsTest.replay") {
+            ReplaySubject<Int>.create(bufferSize: 2)
+        }
+
+        subject.on(.next(1))
+        subject.on(.next(2))
+        subject.on(.next(3))
+
+        let replay = entry("MetricsTest.replay", "replaySubject")
+        XCTAssertEqual(replay?.eventsIn, 3)
+        XCTAssertEqual(replay?.bufferDepth, 2)
+        XCTAssertEqual(replay?.peakBufferDepth, 2)
+
+        subject.dispose()
+
+        XCTAssertEqual(entry("MetricsTest.replay", "replaySubject")?.bufferDepth, 0)
+    }
+}
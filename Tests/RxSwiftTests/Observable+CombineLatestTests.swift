@@ -1711,6 +1711,27 @@ extension ObservableCombineLatestTest {
         }
     }
 
+    func testCombineLatest_NAry_manySources() {
+        let subjects = (0 ..< 1000).map { _ in PublishSubject<Int>() }
+        var emitted = [[Int]]()
+
+        let subscription = Observable.combineLatest(subjects)
+            .subscribe(onNext: { emitted.append($0) })
+
+        for (index, subject) in subjects.enumerated() {
+            subject.onNext(index)
+        }
+        subjects[0].onNext(-1)
+        subjects[999].onNext(-2)
+
+        XCTAssertEqual(emitted.count, 3)
+        XCTAssertEqual(emitted[0], Array(0 ..< 1000))
+        XCTAssertEqual(emitted[1], [-1] + Array(1 ..< 1000))
+        XCTAssertEqual(emitted[2], [-1] + Array(1 ..< 999) + [-2])
+
+        subscription.dispose()
+    }
+
     #if TRACE_RESOURCES
     func testCombineLatestArrayReleasesResourcesOnComplete1() {
         _ = Observable.combineLatest([Observable.just(1), Observable.just(1)]) { $0.reduce(0, +) }.subscribe()
@@ -227,5 +227,105 @@ extension ObservableConcurrencyTests {
         await fulfillment(of: [expectation], timeout: 5.0)
         disposable.dispose()
     }
+
+    func testValuesBufferingPolicyUnbounded() async throws {
+        var values = [Int]()
+
+        for try await value in Observable.from(1 ... 10).values(bufferingPolicy: .unbounded) {
+            values.append(value)
+        }
+
+        XCTAssertEqual(values, Array(1 ... 10))
+    }
+
+    func testValuesBufferingNewestDropsOldest() async throws {
+        let subject = PublishSubject<Int>()
+        var iterator = subject.values(bufferingPolicy: .bufferingNewest(2)).makeAsyncIterator()
+
+        for i in 1 ... 5 {
+            subject.onNext(i)
+        }
+        subject.onCompleted()
+
+        let first = try await iterator.next()
+        let second = try await iterator.next()
+        let end = try await iterator.next()
+        XCTAssertEqual(first, 4)
+        XCTAssertEqual(second, 5)
+        XCTAssertNil(end)
+    }
+
+    func testValuesBufferingOldestDropsNewest() async throws {
+        let subject = PublishSubject<Int>()
+        var iterator = subject.values(bufferingPolicy: .bufferingOldest(2)).makeAsyncIterator()
+
+        for i in 1 ... 5 {
+            subject.onNext(i)
+        }
+        subject.onCompleted()
+
+        let first = try await iterator.next()
+        let second = try await iterator.next()
+        let end = try await iterator.next()
+        XCTAssertEqual(first, 1)
+        XCTAssertEqual(second, 2)
+        XCTAssertNil(end)
+    }
+
+    func testValuesBufferingPolicyErrorAfterBufferedElements() async {
+        let subject = PublishSubject<Int>()
+        var iterator = subject.values(bufferingPolicy: .unbounded).makeAsyncIterator()
+
+        subject.onNext(1)
+        subject.onError(testError)
+
+        do {
+            let first = try await iterator.next()
+            XCTAssertEqual(first, 1)
+            _ = try await iterator.next()
+            XCTFail("Expected an error")
+        } catch {
+            XCTAssertEqual(error as? TestError, testError)
+        }
+    }
+
+    func testValuesBufferingPolicyDisposesWhenIteratorIsReleased() {
+        let subject = PublishSubject<Int>()
+
+        do {
+            let iterator = subject.values(bufferingPolicy: .bufferingNewest(1)).makeAsyncIterator()
+            XCTAssertTrue(subject.hasObservers)
+            _ = iterator
+        }
+
+        XCTAssertFalse(subject.hasObservers)
+    }
+
+    func testAsyncSequenceToObservableOnScheduler() async {
+        let asyncSequence = AsyncStream<Int> { continuation in
+            for i in 1 ... 100 {
+                continuation.yield(i)
+            }
+            continuation.finish()
+        }
+
+        let expectation = XCTestExpectation(description: "Observable completes with all values")
+        var values = [Int]()
+
+        let disposable = asyncSequence
+            .asObservable(scheduler: SerialDispatchQueueScheduler(qos: .default), bufferSize: 4)
+            .subscribe(
+                onNext: { value in
+                    values.append(value)
+                },
+                onCompleted: {
+                    XCTAssertEqual(values, Array(1 ... 100))
+                    expectation.fulfill()
+                }
+            )
+
+        await fulfillment(of: [expectation], timeout: 5.0)
+        disposable.dispose()
+    }
 }
 #endif
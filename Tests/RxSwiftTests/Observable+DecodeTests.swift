@@ -6,6 +6,7 @@
 //  Copyright © 2020 Krunoslav Zaher. All rights reserved.
 //
 
+import RxBlocking
 import RxSwift
 import RxTest
 import XCTest
@@ -58,6 +59,37 @@ extension ObservableDecodeTest {
     }
 }
 
+extension ObservableDecodeTest {
+    func testDecodeInParallelKeepsOrder() throws {
+        let frames = (0 ..< 1000).map { #"{"id": \#($0), "name": "\#($0)"}"#.data(using: .utf8)! }
+
+        let objects = try Observable.from(frames)
+            .decode(type: FakeObject.self, decoder: JSONDecoder(), scheduler: WorkStealingScheduler(workerCount: 4), maxConcurrent: 4)
+            .toBlocking(timeout: 5)
+            .toArray()
+
+        XCTAssertEqual(objects, (0 ..< 1000).map { FakeObject(id: $0, name: "\($0)", country: nil) })
+    }
+
+    func testDecodeInParallelFailsWithDecodingError() {
+        // Frames after the bad one decode fine, so rails can get past it before the error is delivered.
+        var frames = (0 ..< 1000).map { #"{"id": \#($0), "name": "\#($0)"}"#.data(using: .utf8)! }
+        frames[500] = "{".data(using: .utf8)!
+
+        let result = Observable.from(frames)
+            .decode(type: FakeObject.self, decoder: JSONDecoder(), scheduler: WorkStealingScheduler(workerCount: 4), maxConcurrent: 4)
+            .toBlocking(timeout: 5)
+            .materialize()
+
+        guard case let .failed(elements, error) = result else {
+            return XCTFail("Expected result to be complete with error, but result was successful.")
+        }
+
+        XCTAssertEqual(elements, (0 ..< 500).map { FakeObject(id: $0, name: "\($0)", country: nil) })
+        XCTAssertTrue(error is DecodingError)
+    }
+}
+
 private struct FakeObject: Equatable, Decodable {
     let id: Int
     let name: String
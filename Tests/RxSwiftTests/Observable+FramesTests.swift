@@ -0,0 +1,187 @@
+//
+//  Observable+FramesTests.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+import RxSwift
+import RxTest
+import XCTest
+
+class ObservableFramesTest: RxTest {}
+
+private func data(_ string: String) -> Data {
+    string.data(using: .utf8)!
+}
+
+private func data(_ bytes: [UInt8]) -> Data {
+    Data(bytes)
+}
+
+extension ObservableFramesTest {
+    func testNewlineDelimited_splitsChunks() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data("a\nbc")),
+            .next(220, data("d\n\ne")),
+            .next(230, data("f")),
+            .next(240, data("\ng")),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.newlineDelimited)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, data("a")),
+            .next(220, data("bcd")),
+            .next(220, data("")),
+            .next(240, data("ef")),
+            .next(250, data("g")),
+            .completed(250)
+        ])
+    }
+
+    func testNewlineDelimited_emitsLastFrameOnCompletion() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data("a\nb")),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.newlineDelimited)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, data("a")),
+            .next(250, data("b")),
+            .completed(250)
+        ])
+    }
+
+    func testNewlineDelimited_slicesWithoutCopying() {
+        // Long enough to not be stored inline.
+        let chunk = data("the first frame of the chunk\nthe second frame of the chunk\n")
+        var frames = [Data]()
+
+        _ = Observable.just(chunk)
+            .frames(.newlineDelimited)
+            .subscribe(onNext: { frames.append($0) })
+
+        XCTAssertEqual(frames, [data("the first frame of the chunk"), data("the second frame of the chunk")])
+        XCTAssertEqual(frames.map(\.startIndex), [0, 29])
+
+        chunk.withUnsafeBytes { chunkBytes in
+            frames[1].withUnsafeBytes { frameBytes in
+                XCTAssertEqual(frameBytes.baseAddress, chunkBytes.baseAddress! + 29)
+            }
+        }
+    }
+
+    func testNewlineDelimited_frameTooLong() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data("ab\nc")),
+            .next(220, data("de")),
+            .next(230, data("f\n")),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.newlineDelimited, maxFrameLength: 2)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, data("ab")),
+            .error(220, DataFramingError.frameTooLong(length: 3))
+        ])
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 220)
+        ])
+    }
+
+    func testLengthPrefixed_splitsChunks() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data([0, 2, 1, 2, 0])),
+            .next(220, data([3, 3, 4])),
+            .next(230, data([5, 0, 0, 0])),
+            .next(240, data([1, 6])),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.lengthPrefixed(headerSize: 2))
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, data([1, 2])),
+            .next(230, data([3, 4, 5])),
+            .next(230, data([])),
+            .next(240, data([6])),
+            .completed(250)
+        ])
+    }
+
+    func testLengthPrefixed_truncatedFrame() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data([0, 3, 1])),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.lengthPrefixed(headerSize: 2))
+        }
+
+        XCTAssertEqual(res.events, [
+            .error(250, DataFramingError.truncatedFrame)
+        ])
+    }
+
+    func testLengthPrefixed_frameTooLong() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data([0, 0, 1, 0])),
+            .completed(250)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.lengthPrefixed(headerSize: 4), maxFrameLength: 255)
+        }
+
+        XCTAssertEqual(res.events, [
+            .error(210, DataFramingError.frameTooLong(length: 256))
+        ])
+    }
+
+    func testFrames_error() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, data("a\nb")),
+            .error(220, testError)
+        ])
+
+        let res = scheduler.start {
+            xs.frames(.newlineDelimited)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, data("a")),
+            .error(220, testError)
+        ])
+    }
+}
@@ -1146,6 +1146,104 @@ extension ObservableGroupByTest {
         ])
     }
 
+    func testGroupBy_MaxGroupsEvictsLeastRecentlyActive() {
+        let subject = PublishSubject<Int>()
+        var events = [String]()
+
+        let subscription = subject
+            .groupBy(keySelector: { $0 }, maxGroups: 2)
+            .subscribe(onNext: { group in
+                events.append("open \(group.key)")
+                _ = group.subscribe(onNext: { events.append("\(group.key): \($0)") }, onCompleted: { events.append("close \(group.key)") })
+            })
+
+        for value in [1, 2, 3, 2, 1] {
+            subject.onNext(value)
+        }
+
+        XCTAssertEqual(events, [
+            "open 1", "1: 1",
+            "open 2", "2: 2",
+            "close 1", "open 3", "3: 3",
+            "2: 2",
+            "close 3", "open 1", "1: 1"
+        ])
+
+        subscription.dispose()
+    }
+
+    func testGroupBy_ExpiresIdleGroups() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .next(220, 2),
+            .next(250, 1),
+            .next(290, 1),
+            .next(400, 2),
+            .completed(500)
+        ])
+
+        var events = [String]()
+
+        scheduler.scheduleAt(Defaults.subscribed) {
+            _ = xs
+                .groupBy(keySelector: { $0 }, expireAfter: .seconds(50), scheduler: scheduler)
+                .subscribe(onNext: { group in
+                    events.append("\(scheduler.clock) open \(group.key)")
+                    _ = group.subscribe(onCompleted: { events.append("\(scheduler.clock) close \(group.key)") })
+                }, onCompleted: {
+                    events.append("\(scheduler.clock) completed")
+                })
+        }
+
+        scheduler.start()
+
+        XCTAssertEqual(events, [
+            "210 open 1",
+            "220 open 2",
+            "270 close 2",
+            "340 close 1",
+            "400 open 2",
+            "450 close 2",
+            "500 completed"
+        ])
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 500)
+        ])
+    }
+
+    func testGroupBy_ExpiresSingleIdleGroup() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .completed(500)
+        ])
+
+        var events = [String]()
+
+        scheduler.scheduleAt(Defaults.subscribed) {
+            _ = xs
+                .groupBy(keySelector: { $0 }, expireAfter: .seconds(50), scheduler: scheduler)
+                .subscribe(onNext: { group in
+                    events.append("\(scheduler.clock) open \(group.key)")
+                    _ = group.subscribe(onCompleted: { events.append("\(scheduler.clock) close \(group.key)") })
+                }, onCompleted: {
+                    events.append("\(scheduler.clock) completed")
+                })
+        }
+
+        scheduler.start()
+
+        XCTAssertEqual(events, [
+            "210 open 1",
+            "260 close 1",
+            "500 completed"
+        ])
+    }
+
     #if TRACE_RESOURCES
     func testGroupByReleasesResourcesOnComplete() {
         _ = Observable<Int>.just(1).groupBy { $0 }.subscribe()
@@ -384,4 +384,93 @@ extension ObservableMapTest {
         XCTAssertEqual(res.events, correctMessages)
         XCTAssertEqual(xs.subscriptions, correctSubscriptions)
     }
+
+    func testMapFilterCompactMapScanDoCompose_Range() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(150, 1),
+            .next(210, 0),
+            .next(220, 1),
+            .next(230, 2),
+            .next(240, 3),
+            .next(250, 4),
+            .completed(300)
+        ])
+
+        var doneOnNext = [Int]()
+
+        let res = scheduler.start {
+            xs
+                .map { $0 * 10 }
+                .filter { $0 != 10 }
+                .compactMap { $0 == 30 ? nil : $0 + 1 }
+                .scan(0) { $0 + $1 }
+                .do(onNext: { doneOnNext.append($0) })
+        }
+
+        let correctMessages = Recorded.events(
+            .next(210, 1),
+            .next(230, 1 + 21),
+            .next(250, 1 + 21 + 41),
+            .completed(300)
+        )
+
+        let correctSubscriptions = [
+            Subscription(200, 300)
+        ]
+
+        XCTAssertEqual(res.events, correctMessages)
+        XCTAssertEqual(xs.subscriptions, correctSubscriptions)
+        XCTAssertEqual(doneOnNext, [1, 1 + 21, 1 + 21 + 41])
+    }
+
+    func testMapScanCompose_SubscriptionsHaveIndependentState() {
+        let composed = Observable.of(1, 2, 3)
+            .map { $0 * 10 }
+            .scan(0) { $0 + $1 }
+            .filter { $0 > 10 }
+
+        var results1 = [Int]()
+        var results2 = [Int]()
+
+        _ = composed.subscribe(onNext: { results1.append($0) })
+        _ = composed.subscribe(onNext: { results2.append($0) })
+
+        XCTAssertEqual(results1, [30, 60])
+        XCTAssertEqual(results2, [30, 60])
+    }
+
+    func testFilterScanCompose_Selector2Throws() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(150, 1),
+            .next(210, 0),
+            .next(220, 1),
+            .next(230, 2),
+            .next(240, 4),
+            .completed(300)
+        ])
+
+        let res = scheduler.start {
+            xs
+                .filter { $0 != 1 }
+                .scan(0) { acc, x throws -> Int in if x < 4 { return acc + x } else { throw testError } }
+                .map { $0 * 10 }
+        }
+
+        let correctMessages = Recorded.events(
+            .next(210, 0),
+            .next(230, 20),
+            .error(240, testError)
+        )
+
+        let correctSubscriptions = [
+            Subscription(200, 240)
+        ]
+
+        XCTAssertEqual(res.events, correctMessages)
+        XCTAssertEqual(xs.subscriptions, correctSubscriptions)
+    }
 }
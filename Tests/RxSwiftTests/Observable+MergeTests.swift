@@ -3054,3 +3054,277 @@ extension ObservableMergeTest {
     }
     #endif
 }
+
+// MARK: concatMapEager
+
+extension ObservableMergeTest {
+    func testConcatMapEager_SubscribesConcurrentlyEmitsInOrder() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let ys1 = scheduler.createColdObservable([
+            .next(10, 11),
+            .next(40, 12),
+            .completed(50)
+        ])
+
+        let ys2 = scheduler.createColdObservable([
+            .next(10, 21),
+            .completed(20)
+        ])
+
+        let xs = scheduler.createHotObservable([
+            .next(210, ys1),
+            .next(215, ys2),
+            .completed(300)
+        ])
+
+        let results = scheduler.start {
+            xs.concatMapEager(maxConcurrent: 2) {
+                $0
+            }
+        }
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 300)
+        ])
+
+        XCTAssertEqual(ys1.subscriptions, [
+            Subscription(210, 260)
+        ])
+
+        XCTAssertEqual(ys2.subscriptions, [
+            Subscription(215, 235)
+        ])
+
+        XCTAssertEqual(results.events, [
+            .next(220, 11),
+            .next(250, 12),
+            .next(260, 21),
+            .completed(300)
+        ])
+    }
+
+    func testConcatMapEager_MaxConcurrentLimitsSubscriptions() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let ys1 = scheduler.createColdObservable([
+            .next(10, 11),
+            .completed(50)
+        ])
+
+        let ys2 = scheduler.createColdObservable([
+            .next(10, 21),
+            .completed(20)
+        ])
+
+        let ys3 = scheduler.createColdObservable([
+            .next(5, 31),
+            .completed(10)
+        ])
+
+        let xs = scheduler.createHotObservable([
+            .next(210, ys1),
+            .next(215, ys2),
+            .next(220, ys3),
+            .completed(230)
+        ])
+
+        let results = scheduler.start {
+            xs.concatMapEager(maxConcurrent: 2) {
+                $0
+            }
+        }
+
+        XCTAssertEqual(ys1.subscriptions, [
+            Subscription(210, 260)
+        ])
+
+        XCTAssertEqual(ys2.subscriptions, [
+            Subscription(215, 235)
+        ])
+
+        XCTAssertEqual(ys3.subscriptions, [
+            Subscription(260, 270)
+        ])
+
+        XCTAssertEqual(results.events, [
+            .next(220, 11),
+            .next(260, 21),
+            .next(265, 31),
+            .completed(270)
+        ])
+    }
+
+    func testConcatMapEager_InnerError() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let ys1 = scheduler.createColdObservable([
+            .next(10, 11),
+            .completed(50)
+        ])
+
+        let ys2: TestableObservable<Int> = scheduler.createColdObservable([
+            .error(10, testError)
+        ])
+
+        let xs = scheduler.createHotObservable([
+            .next(210, ys1),
+            .next(215, ys2),
+            .completed(300)
+        ])
+
+        let results = scheduler.start {
+            xs.concatMapEager(maxConcurrent: 2) {
+                $0
+            }
+        }
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 225)
+        ])
+
+        XCTAssertEqual(ys1.subscriptions, [
+            Subscription(210, 225)
+        ])
+
+        XCTAssertEqual(results.events, [
+            .next(220, 11),
+            .error(225, testError)
+        ])
+    }
+
+    func testConcatMapEager_SelectorThrows() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .next(220, 2),
+            .completed(300)
+        ])
+
+        let results = scheduler.start {
+            xs.concatMapEager(maxConcurrent: 2) { value -> Observable<Int> in
+                if value == 2 {
+                    throw testError
+                }
+                return Observable.never()
+            }
+        }
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 220)
+        ])
+
+        XCTAssertEqual(results.events, [
+            .error(220, testError)
+        ])
+    }
+
+    func testConcatMapEager_PrefetchOverflow() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let ys1 = scheduler.createColdObservable([
+            .completed(50)
+        ])
+
+        let ys2 = scheduler.createColdObservable([
+            .next(10, 21),
+            .next(20, 22),
+            .completed(30)
+        ])
+
+        let xs = scheduler.createHotObservable([
+            .next(210, ys1),
+            .next(215, ys2),
+            .completed(300)
+        ])
+
+        let results = scheduler.start {
+            xs.concatMapEager(maxConcurrent: 2, prefetch: 1) {
+                $0
+            }
+        }
+
+        XCTAssertEqual(results.events, [
+            .error(235, RxError.bufferOverflow)
+        ])
+    }
+
+    func testConcatMapEager_PrefetchDoesntLimitSynchronousHead() {
+        var results = [Int]()
+        var error: Swift.Error?
+
+        _ = Observable.of(0, 1)
+            .concatMapEager(maxConcurrent: 2, prefetch: 2) { i in
+                Observable<Int>.create { observer in
+                    for element in i * 10 ..< i * 10 + 10 {
+                        observer.on(.next(element))
+                    }
+                    observer.on(.completed)
+                    return Disposables.create()
+                }
+            }
+            .subscribe(onNext: { results.append($0) }, onError: { error = $0 })
+
+        XCTAssertNil(error)
+        XCTAssertEqual(results, Array(0 ..< 20))
+    }
+
+    func testConcatMapEager_Disposed() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let ys1 = scheduler.createColdObservable([
+            .next(10, 11),
+            .completed(50)
+        ])
+
+        let ys2 = scheduler.createColdObservable([
+            .next(10, 21),
+            .completed(20)
+        ])
+
+        let xs = scheduler.createHotObservable([
+            .next(210, ys1),
+            .next(215, ys2),
+            .completed(300)
+        ])
+
+        let results = scheduler.start(disposed: 240) {
+            xs.concatMapEager(maxConcurrent: 2) {
+                $0
+            }
+        }
+
+        XCTAssertEqual(ys1.subscriptions, [
+            Subscription(210, 240)
+        ])
+
+        XCTAssertEqual(ys2.subscriptions, [
+            Subscription(215, 235)
+        ])
+
+        XCTAssertEqual(results.events, [
+            .next(220, 11)
+        ])
+    }
+
+    func testConcatMapEager_SynchronousInnerSequencesDontRecurse() {
+        var results = [Int]()
+
+        _ = Observable.range(start: 0, count: 100_000)
+            .concatMapEager(maxConcurrent: 4) { Observable.just($0) }
+            .subscribe(onNext: { results.append($0) })
+
+        XCTAssertEqual(results, Array(0 ..< 100_000))
+    }
+
+    #if TRACE_RESOURCES
+    func testConcatMapEagerReleasesResourcesOnComplete() {
+        _ = Observable<Int>.just(1).concatMapEager(maxConcurrent: 2) { _ in Observable.just(1) }.subscribe()
+    }
+
+    func testConcatMapEagerReleasesResourcesOnError() {
+        _ = Observable<Int>.just(1).concatMapEager(maxConcurrent: 2) { _ -> Observable<Int> in Observable.error(testError) }.subscribe()
+    }
+    #endif
+}
@@ -695,3 +695,130 @@ final class ObservableObserveOnTestConcurrentSchedulerTest2: ObservableObserveOn
         ConcurrentDispatchQueueScheduler(qos: .default)
     }
 }
+
+// observeOn with bounded buffer
+extension ObservableObserveOnTest {
+    func testObserveOnBuffered_DeliversInOrder() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let res = scheduler.start {
+            Observable.from([1, 2, 3]).observe(on: scheduler, bufferSize: 3, overflow: .error)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 1),
+            .next(201, 2),
+            .next(201, 3),
+            .completed(201)
+        ])
+    }
+
+    func testObserveOnBuffered_DropNewest() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let res = scheduler.start {
+            Observable.from(Array(1 ... 10)).observe(on: scheduler, bufferSize: 3, overflow: .dropNewest)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 1),
+            .next(201, 2),
+            .next(201, 3),
+            .completed(201)
+        ])
+    }
+
+    func testObserveOnBuffered_DropOldest() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let res = scheduler.start {
+            Observable.from(Array(1 ... 10)).observe(on: scheduler, bufferSize: 3, overflow: .dropOldest)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 8),
+            .next(201, 9),
+            .next(201, 10),
+            .completed(201)
+        ])
+    }
+
+    func testObserveOnBuffered_Error() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let res = scheduler.start {
+            Observable.from(Array(1 ... 10)).observe(on: scheduler, bufferSize: 3, overflow: .error)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 1),
+            .next(201, 2),
+            .next(201, 3),
+            .error(201, RxError.bufferOverflow)
+        ])
+    }
+
+    func testObserveOnBuffered_ErrorDisposesSourceOnOverflow() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .next(210, 2),
+            .next(210, 3),
+            .next(210, 4),
+            .next(220, 5),
+            .completed(230)
+        ])
+
+        let res = scheduler.start {
+            xs.observe(on: scheduler, bufferSize: 3, overflow: .error)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(211, 1),
+            .next(211, 2),
+            .next(211, 3),
+            .error(211, RxError.bufferOverflow)
+        ])
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 210)
+        ])
+    }
+
+    func testObserveOnBuffered_Dispose() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .next(220, 2),
+            .next(230, 3),
+            .completed(240)
+        ])
+
+        let res = scheduler.start(disposed: 225) {
+            xs.observe(on: scheduler, bufferSize: 3, overflow: .error)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(211, 1),
+            .next(221, 2)
+        ])
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 225)
+        ])
+    }
+
+    func testObserveOnBuffered_BlockDeliversEverything() {
+        let scheduler = SerialDispatchQueueScheduler(qos: .default)
+        let count = 1000
+
+        let elements = try! Observable.from(Array(0 ..< count), scheduler: ConcurrentDispatchQueueScheduler(qos: .default))
+            .observe(on: scheduler, bufferSize: 2, overflow: .block)
+            .toBlocking()
+            .toArray()
+
+        XCTAssertEqual(elements, Array(0 ..< count))
+    }
+}
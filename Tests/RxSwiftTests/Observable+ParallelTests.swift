@@ -0,0 +1,172 @@
+//
+//  Observable+ParallelTests.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+import RxBlocking
+import RxSwift
+import RxTest
+import XCTest
+
+class ObservableParallelTest: RxTest {}
+
+extension ObservableParallelTest {
+    func testParallel_orderedPreservesSourceOrder() throws {
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+
+        let result = try Observable.from(Array(0 ..< 1000))
+            .parallel(on: scheduler, rails: 4)
+            .map { $0 * 2 }
+            .sequential(ordered: true)
+            .toBlocking(timeout: 5.0)
+            .toArray()
+
+        XCTAssertEqual(result, (0 ..< 1000).map { $0 * 2 })
+    }
+
+    func testParallel_unorderedDeliversAllElements() throws {
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+
+        let result = try Observable.from(Array(0 ..< 1000))
+            .parallel(on: scheduler, rails: 4)
+            .map { $0 + 1 }
+            .sequential(ordered: false)
+            .toBlocking(timeout: 5.0)
+            .toArray()
+
+        XCTAssertEqual(result.sorted(), Array(1 ... 1000))
+    }
+
+    func testParallel_filterAndCompactMap() throws {
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+
+        let result = try Observable.from(Array(0 ..< 100))
+            .parallel(on: scheduler, rails: 3)
+            .filter { $0 % 2 == 0 }
+            .compactMap { $0 % 3 == 0 ? nil : "\($0)" }
+            .sequential()
+            .toBlocking(timeout: 5.0)
+            .toArray()
+
+        XCTAssertEqual(result, (0 ..< 100).filter { $0 % 2 == 0 && $0 % 3 != 0 }.map { "\($0)" })
+    }
+
+    func testParallel_runsRailsOnMultipleThreads() throws {
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+        let threads = Synchronized(Set<String>())
+
+        _ = try Observable.from(Array(0 ..< 400))
+            .parallel(on: scheduler, rails: 4)
+            .map { value -> Int in
+                Thread.sleep(forTimeInterval: 0.001)
+                threads.mutate { $0.insert("\(Unmanaged.passUnretained(Thread.current).toOpaque())") }
+                return value
+            }
+            .sequential()
+            .toBlocking(timeout: 10.0)
+            .toArray()
+
+        XCTAssertGreaterThan(threads.value.count, 1)
+    }
+
+    func testParallel_transformErrorTerminatesSequence() {
+        let scheduler = WorkStealingScheduler(workerCount: 2)
+
+        let result = Observable.from(Array(0 ..< 100))
+            .parallel(on: scheduler, rails: 2)
+            .map { value -> Int in
+                if value == 50 {
+                    throw testError
+                }
+                return value
+            }
+            .sequential()
+            .toBlocking(timeout: 5.0)
+            .materialize()
+
+        switch result {
+        case .completed:
+            XCTFail("Expected an error")
+        case let .failed(_, error):
+            XCTAssertEqual(error as? TestError, testError)
+        }
+    }
+
+    func testParallel_unorderedTransformErrorFollowsPrecedingElements() {
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+
+        let result = Observable.from(Array(0 ..< 1000))
+            .parallel(on: scheduler, rails: 4)
+            .map { value -> Int in
+                if value == 500 {
+                    throw testError
+                }
+                return value
+            }
+            .sequential(ordered: false)
+            .toBlocking(timeout: 5.0)
+            .materialize()
+
+        switch result {
+        case .completed:
+            XCTFail("Expected an error")
+        case let .failed(elements, error):
+            XCTAssertTrue(Set(0 ..< 500).isSubset(of: elements))
+            XCTAssertEqual(error as? TestError, testError)
+        }
+    }
+
+    func testParallel_sourceError() {
+        let scheduler = WorkStealingScheduler(workerCount: 2)
+
+        let result = Observable<Int>.error(testError)
+            .parallel(on: scheduler, rails: 2)
+            .map { $0 }
+            .sequential()
+            .toBlocking(timeout: 5.0)
+            .materialize()
+
+        switch result {
+        case .completed:
+            XCTFail("Expected an error")
+        case let .failed(elements, error):
+            XCTAssertEqual(elements, [])
+            XCTAssertEqual(error as? TestError, testError)
+        }
+    }
+
+    func testParallel_emptySourceCompletes() throws {
+        let result = try Observable<Int>.empty()
+            .parallel(on: CurrentThreadScheduler.instance, rails: 2)
+            .map { $0 }
+            .sequential()
+            .toBlocking()
+            .toArray()
+
+        XCTAssertEqual(result, [])
+    }
+
+    func testParallel_immediateSchedulerKeepsOrder() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        let res = scheduler.start {
+            Observable.from([1, 2, 3, 4, 5])
+                .parallel(on: CurrentThreadScheduler.instance, rails: 2)
+                .map { $0 * 10 }
+                .sequential()
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(200, 10),
+            .next(200, 20),
+            .next(200, 30),
+            .next(200, 40),
+            .next(200, 50),
+            .completed(200),
+        ])
+    }
+}
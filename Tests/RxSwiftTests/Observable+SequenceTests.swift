@@ -154,4 +154,135 @@ extension ObservableSequenceTest {
         testScheduler.start()
     }
     #endif
+
+// MARK: batches
+
+extension ObservableSequenceTest {
+    func testFromArrayBatched_deliversBatchesThroughOperators() {
+        let scheduler = TestScheduler(initialClock: 0)
+        let res = scheduler.start {
+            Observable.from([1, 2, 3, 4, 5], batchSize: 2, scheduler: scheduler)
+                .map { $0 * 10 }
+                .filter { $0 != 30 }
+                .scan(0, accumulator: +)
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 10),
+            .next(201, 30),
+            .next(202, 70),
+            .next(203, 120),
+            .completed(204)
+        ])
+    }
+
+    func testFromArrayBatched_dispose() {
+        let scheduler = TestScheduler(initialClock: 0)
+        let res = scheduler.start(disposed: 202) {
+            Observable.from([1, 2, 3, 4, 5], batchSize: 2, scheduler: scheduler)
+                .map { $0 * 10 }
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 10),
+            .next(201, 20)
+        ])
+    }
+
+    func testFromArrayBatched_errorInsideBatch() {
+        let scheduler = TestScheduler(initialClock: 0)
+        let res = scheduler.start {
+            Observable.from([1, 2, 3, 4, 5], batchSize: 5, scheduler: scheduler)
+                .map { element -> Int in
+                    if element == 3 {
+                        throw testError
+                    }
+                    return element
+                }
+                .map { $0 * 10 }
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(201, 10),
+            .next(201, 20),
+            .error(201, testError)
+        ])
+    }
+
+    func testFromArrayBatched_nonBatchObserverStopsEarly() {
+        var transformed = [Int]()
+        var received = [Int]()
+
+        _ = Observable.from([1, 2, 3, 4, 5], batchSize: 5)
+            .map { element -> Int in
+                transformed.append(element)
+                return element
+            }
+            .take(2)
+            .subscribe(onNext: { received.append($0) })
+
+        XCTAssertEqual(received, [1, 2])
+        XCTAssertEqual(transformed, [1, 2])
+    }
+
+    func testFromArrayBatched_aggregates() {
+        var arrays = [[Int]]()
+        var sums = [Int]()
+        var buffers = [[Int]]()
+
+        let source = Observable.from(Array(1 ... 10), batchSize: 4)
+        _ = source.toArray().subscribe(onSuccess: { arrays.append($0) })
+        _ = source.reduce(0, accumulator: +).subscribe(onNext: { sums.append($0) })
+        _ = source.buffer(timeSpan: .seconds(100), count: 3, scheduler: TestScheduler(initialClock: 0))
+            .subscribe(onNext: { buffers.append($0) })
+        _ = source.filter { $0 % 2 == 0 }.map { $0 * 10 }.toArray().subscribe(onSuccess: { arrays.append($0) })
+
+        XCTAssertEqual(arrays, [Array(1 ... 10), [20, 40, 60, 80, 100]])
+        XCTAssertEqual(sums, [55])
+        XCTAssertEqual(buffers, [[1, 2, 3], [4, 5, 6], [7, 8, 9], [10]])
+    }
+
+    func testFromArrayBatched_errorInsideBatchForwardsCompletedResults() {
+        var sums = [Int]()
+        var errors = [Swift.Error]()
+
+        _ = Observable.from([1, 2, 3, 4, 5], batchSize: 5)
+            .map { element -> Int in
+                if element == 3 {
+                    throw testError
+                }
+                return element
+            }
+            .scan(0, accumulator: +)
+            .reduce(0) { max($0, $1) }
+            .subscribe(onNext: { sums.append($0) }, onError: { errors.append($0) })
+
+        XCTAssertEqual(sums, [])
+        XCTAssertEqual(errors.count, 1)
+    }
+
+    func testUnbatched() {
+        let scheduler = TestScheduler(initialClock: 0)
+        let xs = scheduler.createHotObservable([
+            .next(210, [1, 2]),
+            .next(220, []),
+            .next(230, [3]),
+            .completed(240)
+        ])
+
+        let res = scheduler.start {
+            xs.unbatched().map { $0 * 2 }
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, 2),
+            .next(210, 4),
+            .next(230, 6),
+            .completed(240)
+        ])
+
+        XCTAssertEqual(xs.subscriptions, [
+            Subscription(200, 240)
+        ])
+    }
 }
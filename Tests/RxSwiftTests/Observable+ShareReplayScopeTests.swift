@@ -6,6 +6,7 @@
 //  Copyright © 2017 Krunoslav Zaher. All rights reserved.
 //
 
+import Dispatch
 import RxSwift
 import RxTest
 import XCTest
@@ -528,6 +529,107 @@ extension ObservableShareReplayScopeTests {
         }
     }
 
+    func test_whileConnected_replaysAcrossSegments() {
+        let subject = PublishSubject<Int>()
+        let shared = subject.share(replay: 100, scope: .whileConnected)
+
+        let connection = shared.subscribe()
+        for i in 0 ..< 1000 {
+            subject.onNext(i)
+        }
+
+        var replayed = [Int]()
+        let late = shared.subscribe(onNext: { replayed.append($0) })
+        subject.onNext(1000)
+
+        XCTAssertEqual(replayed, Array(900 ... 1000))
+
+        connection.dispose()
+        late.dispose()
+
+        var reconnected = [Int]()
+        _ = shared.subscribe(onNext: { reconnected.append($0) })
+
+        XCTAssertEqual(reconnected, [])
+    }
+
+    func test_whileConnected_subscribeWhileEmitting() {
+        let subject = PublishSubject<Int>()
+        let shared = subject.share(replay: 100, scope: .whileConnected)
+        let count = 20000
+
+        let connection = shared.subscribe()
+        let started = DispatchSemaphore(value: 0)
+        let finished = DispatchSemaphore(value: 0)
+
+        DispatchQueue.global().async {
+            for i in 0 ..< count {
+                subject.onNext(i)
+                if i == 1000 {
+                    started.signal()
+                }
+            }
+            finished.signal()
+        }
+
+        started.wait()
+
+        let received = Synchronized([Int]())
+        let running = Synchronized(0)
+        let overlapped = Synchronized(false)
+
+        let late = shared.subscribe(onNext: { element in
+            let isAlone = running.mutate { running -> Bool in
+                running += 1
+                return running == 1
+            }
+            if !isAlone {
+                overlapped.mutate { $0 = true }
+            }
+            received.mutate { $0.append(element) }
+            running.mutate { $0 -= 1 }
+        })
+
+        finished.wait()
+
+        let elements = received.value
+        XCTAssertEqual(elements.last, count - 1)
+        XCTAssertEqual(elements, Array((elements.first ?? 0) ..< count))
+        XCTAssertFalse(overlapped.value)
+
+        connection.dispose()
+        late.dispose()
+    }
+
+    func test_whileConnected_replayDoesntBlockSource() {
+        let subject = PublishSubject<Int>()
+        let shared = subject.share(replay: 2, scope: .whileConnected)
+
+        let connection = shared.subscribe()
+        subject.onNext(1)
+        subject.onNext(2)
+
+        let emitted = DispatchSemaphore(value: 0)
+        var received = [Int]()
+
+        // The source emits on another thread while the late subscriber is still in its replay.
+        let late = shared.subscribe(onNext: { element in
+            received.append(element)
+            if element == 1 {
+                DispatchQueue.global().async {
+                    subject.onNext(3)
+                    emitted.signal()
+                }
+                XCTAssertEqual(emitted.wait(timeout: .now() + 5), .success)
+            }
+        })
+
+        XCTAssertEqual(received, [1, 2, 3])
+
+        connection.dispose()
+        late.dispose()
+    }
+
     #if TRACE_RESOURCES
     func testReleasesResourcesOnComplete() {
         for i in 0 ..< 5 {
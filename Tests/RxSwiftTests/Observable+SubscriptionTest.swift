@@ -205,4 +205,48 @@ class ObservableSubscriptionTests: RxTest {
         XCTAssertTrue(onCompletedCalled == 0)
         XCTAssertTrue(onDisposedCalled == 1)
     }
+
+    func testSubscribeWithoutOnDisposed_disposesUpstream() {
+        let publishSubject = PublishSubject<Int>()
+
+        var elements = [Int]()
+
+        let subscription = publishSubject
+            .map { $0 * 2 }
+            .subscribe(onNext: { elements.append($0) })
+
+        publishSubject.on(.next(1))
+        XCTAssertTrue(publishSubject.hasObservers)
+
+        subscription.dispose()
+        publishSubject.on(.next(2))
+
+        XCTAssertEqual(elements, [2])
+        XCTAssertFalse(publishSubject.hasObservers)
+    }
+
+    func testCreate_ignoresEventsAfterTerminationAndDisposal() {
+        var observer: AnyObserver<Int>?
+        var events = [Event<Int>]()
+
+        let subscription = Observable<Int>.create { o in
+            observer = o
+            return Disposables.create()
+        }
+        .subscribe { events.append($0) }
+
+        observer?.on(.next(1))
+        observer?.on(.completed)
+        observer?.on(.next(2))
+        observer?.on(.error(testError))
+
+        XCTAssertEqual(events.count, 2)
+        XCTAssertEqual(events.first?.element, 1)
+        XCTAssertTrue(events.last?.isCompleted == true)
+
+        subscription.dispose()
+        observer?.on(.next(3))
+
+        XCTAssertEqual(events.count, 2)
+    }
 }
@@ -0,0 +1,86 @@
+//
+//  Observable+TraceTests.swift
+//  Tests
+//
+//  Created by RxSwift Contributors on 10/17/26.
+//  Copyright © 2026 Krunoslav Zaher. All rights reserved.
+//
+
+import Foundation
+import RxSwift
+import RxTest
+import XCTest
+
+final class ObservableTraceTest: RxTest {
+    override func tearDown() {
+        Tracing.isEnabled = false
+        Tracing.clear()
+        super.tearDown()
+    }
+
+    private func traceEvents() throws -> [[String: Any]] {
+        let trace = try JSONSerialization.jsonObject(with: Tracing.chromeTrace()) as? [String: Any]
+        return trace?["traceEvents"] as? [[String: Any]] ?? []
+    }
+
+    func testTrace_disabledForwardsWithoutRecording() throws {
+        Tracing.clear()
+
+        let scheduler = TestScheduler(initialClock: 0)
+        let xs = scheduler.createHotObservable([
+            .next(210, 1),
+            .completed(220)
+        ])
+
+        let res = scheduler.start {
+            xs.trace("ObservableTraceTest.disabled")
+        }
+
+        XCTAssertEqual(res.events, [
+            .next(210, 1),
+            .completed(220)
+        ])
+        XCTAssertTrue(try traceEvents().isEmpty)
+    }
+
+    func testTrace_recordsSubscriptionLifetime() throws {
+        Tracing.isEnabled = true
+        Tracing.clear()
+
+        let subject = PublishSubject<Int>()
+        var elements = [Int]()
+
+        let subscription = subject
+            .trace("ObservableTraceTest.lifetime", elementHash: { $0 * 10 })
+            .subscribe(onNext: { elements.append($0) })
+
+        subject.on(.next(1))
+        subject.on(.next(2))
+        subject.on(.completed)
+        subscription.dispose()
+
+        XCTAssertEqual(elements, [1, 2])
+
+        let events = try traceEvents()
+        XCTAssertEqual(events.compactMap { $0["ph"] as? String }, ["b", "n", "n", "n", "e"])
+        XCTAssertEqual(events.first?["name"] as? String, "ObservableTraceTest.lifetime")
+        XCTAssertEqual(events.last?["name"] as? String, "ObservableTraceTest.lifetime")
+        XCTAssertEqual(events.compactMap { ($0["args"] as? [String: Any])?["hash"] as? Int }, [10, 20])
+        XCTAssertEqual(events.compactMap { $0["name"] as? String }.dropFirst().dropLast(), ["next", "next", "completed"])
+        XCTAssertEqual(Set(events.compactMap { $0["id"] as? Int }).count, 1)
+    }
+
+    func testTrace_separatesSubscriptions() throws {
+        Tracing.isEnabled = true
+        Tracing.clear()
+
+        let traced = Observable.of(1, 2).trace("ObservableTraceTest.subscriptions")
+
+        _ = traced.subscribe()
+        _ = traced.subscribe()
+
+        let events = try traceEvents()
+        XCTAssertEqual(events.count, 10)
+        XCTAssertEqual(Set(events.compactMap { $0["id"] as? Int }).count, 2)
+    }
+}
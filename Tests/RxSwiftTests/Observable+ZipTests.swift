@@ -807,6 +807,27 @@ extension ObservableZipTest {
         }
     }
 
+    func testZip_NAry_manySources() {
+        let subjects = (0 ..< 1000).map { _ in PublishSubject<Int>() }
+        var sums = [Int]()
+
+        let subscription = Observable.zip(subjects, resultSelector: { $0.reduce(0, +) })
+            .subscribe(onNext: { sums.append($0) })
+
+        for round in 1 ... 3 {
+            for (index, subject) in subjects.enumerated() {
+                subject.onNext(index * round)
+                if index < subjects.count - 1 {
+                    XCTAssertEqual(sums.count, round - 1)
+                }
+            }
+        }
+
+        XCTAssertEqual(sums, [499_500, 999_000, 1_498_500])
+
+        subscription.dispose()
+    }
+
     #if TRACE_RESOURCES
     func testZipArrayReleasesResourcesOnComplete1() {
         _ = Observable.zip([Observable.just(1), Observable.just(1)]) { $0.reduce(0, +) }.subscribe()
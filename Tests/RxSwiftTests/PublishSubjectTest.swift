@@ -69,4 +69,40 @@ class PublishSubjectTest: RxTest {
 
         scheduler.start()
     }
+
+    func test_unsubscribeDuringDispatchAffectsOnlyNextEvents() {
+        let subject = PublishSubject<Int>()
+
+        var events1 = [Int]()
+        var events2 = [Int]()
+        var events3 = [Int]()
+
+        var subscription2: Disposable!
+
+        let subscription1 = subject.subscribe(onNext: { value in
+            events1.append(value)
+            subscription2.dispose()
+        })
+        subscription2 = subject.subscribe(onNext: { events2.append($0) })
+        let subscription3 = subject.subscribe(onNext: { events3.append($0) })
+
+        subject.on(.next(1))
+        subject.on(.next(2))
+
+        XCTAssertEqual(events1, [1, 2])
+        XCTAssertEqual(events2, [1])
+        XCTAssertEqual(events3, [1, 2])
+
+        let subscription4 = subject.subscribe(onNext: { events2.append($0) })
+
+        subject.on(.next(3))
+
+        XCTAssertEqual(events1, [1, 2, 3])
+        XCTAssertEqual(events2, [1, 3])
+        XCTAssertEqual(events3, [1, 2, 3])
+
+        subscription1.dispose()
+        subscription3.dispose()
+        subscription4.dispose()
+    }
 }
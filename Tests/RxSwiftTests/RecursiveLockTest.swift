@@ -83,6 +83,8 @@ private protocol Lock {
 
 extension RecursiveLock: Lock {}
 
+extension NonRecursiveLock: Lock {}
+
 private struct NoLock: Lock {
     func lock() {}
 
@@ -121,6 +123,7 @@ extension RecursiveLockTests {
         }
 
         performTestLock(lock: RecursiveLock(), expectedValues: [1, 2])
+        performTestLock(lock: NonRecursiveLock(), expectedValues: [1, 2])
         performTestLock(lock: NoLock(), expectedValues: [2, 1])
     }
 
@@ -280,4 +280,91 @@ class ReplaySubjectTest: RxTest {
 
         scheduler.start()
     }
+
+    func test_replaysAcrossSegments() {
+        let subject = ReplaySubject<Int>.create(bufferSize: 100)
+        for i in 0 ..< 1000 {
+            subject.onNext(i)
+        }
+
+        var replayed = [Int]()
+        _ = subject.subscribe(onNext: { replayed.append($0) })
+
+        XCTAssertEqual(replayed, Array(900 ..< 1000))
+    }
+
+    func test_unboundedReplaysAcrossSegments() {
+        let subject = ReplaySubject<Int>.createUnbounded()
+        for i in 0 ..< 200 {
+            subject.onNext(i)
+        }
+
+        var replayed = [Int]()
+        _ = subject.subscribe(onNext: { replayed.append($0) })
+
+        XCTAssertEqual(replayed, Array(0 ..< 200))
+    }
+
+    func test_snapshotIsNotAffectedByLaterElements() {
+        let subject = ReplaySubject<Int>.create(bufferSize: 2)
+        subject.onNext(1)
+        subject.onNext(2)
+
+        var replayed = [Int]()
+        _ = subject.subscribe(onNext: { element in
+            replayed.append(element)
+            if element == 1 {
+                subject.onNext(3)
+            }
+        })
+
+        XCTAssertEqual(replayed, [1, 2, 3])
+    }
+
+    func test_timeWindow_dropsExpiredElements() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        var subject: ReplaySubject<Int>! = nil
+        let result = scheduler.createObserver(Int.self)
+        var subscription: Disposable! = nil
+
+        scheduler.scheduleAt(100) { subject = ReplaySubject.create(bufferSize: 10, window: .seconds(100), scheduler: scheduler) }
+        scheduler.scheduleAt(150) { subject.onNext(1) }
+        scheduler.scheduleAt(200) { subject.onNext(2) }
+        scheduler.scheduleAt(250) { subject.onNext(3) }
+        scheduler.scheduleAt(300) { subject.onNext(4) }
+        scheduler.scheduleAt(320) { subscription = subject.subscribe(result) }
+        scheduler.scheduleAt(330) { subject.onNext(5) }
+        scheduler.scheduleAt(400) { subject.onCompleted() }
+        scheduler.scheduleAt(500) { subscription.dispose() }
+
+        scheduler.start()
+
+        XCTAssertEqual(result.events, [
+            .next(320, 3),
+            .next(320, 4),
+            .next(330, 5),
+            .completed(400)
+        ])
+    }
+
+    func test_timeWindow_boundedBySize() {
+        let scheduler = TestScheduler(initialClock: 0)
+
+        var subject: ReplaySubject<Int>! = nil
+        let result = scheduler.createObserver(Int.self)
+
+        scheduler.scheduleAt(100) { subject = ReplaySubject.create(bufferSize: 2, window: .seconds(1000), scheduler: scheduler) }
+        scheduler.scheduleAt(150) { subject.onNext(1) }
+        scheduler.scheduleAt(200) { subject.onNext(2) }
+        scheduler.scheduleAt(250) { subject.onNext(3) }
+        scheduler.scheduleAt(300) { _ = subject.subscribe(result) }
+
+        scheduler.start()
+
+        XCTAssertEqual(result.events, [
+            .next(300, 2),
+            .next(300, 3)
+        ])
+    }
 }
@@ -7,6 +7,7 @@
 //
 
 import RxSwift
+import RxBlocking
 import XCTest
 #if os(Linux)
 import Dispatch
@@ -29,6 +30,10 @@ final class SerialDispatchQueueSchedulerTests: RxTest {
 
 class OperationQueueSchedulerTests: RxTest {}
 
+final class TimerWheelSchedulerTests: RxTest {}
+
+final class WorkStealingSchedulerTests: RxTest {}
+
 extension ConcurrentDispatchQueueSchedulerTests {
     func test_scheduleRelative() {
         let expectScheduling = expectation(description: "wait")
@@ -170,3 +175,308 @@ extension OperationQueueSchedulerTests {
         XCTAssertEqual(["HIGH", "HIGH", "LOW"], times)
     }
 }
+
+extension TimerWheelSchedulerTests {
+    func test_scheduleRelativeOrdering() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = TimerWheelScheduler()
+        let order = Synchronized([Int]())
+
+        for (value, dueTime) in [(3, 90), (1, 30), (2, 60)] {
+            _ = scheduler.scheduleRelative(value, dueTime: .milliseconds(dueTime)) { value -> Disposable in
+                order.mutate { $0.append(value) }
+                if value == 3 {
+                    expectScheduling.fulfill()
+                }
+                return Disposables.create()
+            }
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(order.value, [1, 2, 3])
+    }
+
+    func test_scheduleRelativeNeverRunsEarly() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = TimerWheelScheduler(resolution: .milliseconds(10))
+        let start = Date()
+
+        var interval = 0.0
+
+        _ = scheduler.scheduleRelative(1, dueTime: .milliseconds(105)) { _ -> Disposable in
+            interval = Date().timeIntervalSince(start)
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertGreaterThanOrEqual(interval, 0.105)
+        XCTAssertEqual(interval, 0.11, accuracy: 0.1)
+    }
+
+    func test_scheduleRelativeBeyondWheelRange() {
+        let expectScheduling = expectation(description: "wait")
+        // 64^4 ticks of 1ns cover ~16.7ms, so this item has to be parked and redistributed.
+        let scheduler = TimerWheelScheduler(resolution: .nanoseconds(1))
+        let start = Date()
+
+        var interval = 0.0
+
+        _ = scheduler.scheduleRelative(1, dueTime: .milliseconds(50)) { _ -> Disposable in
+            interval = Date().timeIntervalSince(start)
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertGreaterThanOrEqual(interval, 0.05)
+    }
+
+    func test_scheduleRelativeSaturatesFarFuture() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = TimerWheelScheduler()
+        let fired = Synchronized([Int]())
+
+        // Doesn't fit into `Int64` nanoseconds.
+        let farFuture = scheduler.scheduleRelative(1, dueTime: .seconds(Int.max)) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            return Disposables.create()
+        }
+
+        _ = scheduler.scheduleRelative(2, dueTime: .milliseconds(10)) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        farFuture.dispose()
+
+        XCTAssertEqual(fired.value, [2])
+    }
+
+    func test_scheduleRelativeCancel() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = TimerWheelScheduler()
+        let fired = Synchronized([Int]())
+
+        let disposables = (0 ..< 1000).map { value in
+            scheduler.scheduleRelative(value, dueTime: .milliseconds(20 + value % 50)) { value -> Disposable in
+                fired.mutate { $0.append(value) }
+                return Disposables.create()
+            }
+        }
+
+        for (value, disposable) in disposables.enumerated() where value != 500 {
+            disposable.dispose()
+        }
+
+        DispatchQueue.main.asyncAfter(deadline: .now() + .milliseconds(200)) {
+            expectScheduling.fulfill()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, [500])
+    }
+
+    func test_scheduleRelativeDisposesActionResult() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = TimerWheelScheduler()
+        let isDisposed = Synchronized(false)
+
+        let disposable = scheduler.scheduleRelative(1, dueTime: .milliseconds(10)) { _ -> Disposable in
+            expectScheduling.fulfill()
+            return Disposables.create {
+                isDisposed.mutate { $0 = true }
+            }
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertFalse(isDisposed.value)
+        disposable.dispose()
+        XCTAssertTrue(isDisposed.value)
+    }
+
+    func test_debounce() {
+        let scheduler = TimerWheelScheduler()
+
+        let result = Observable.from(Array(0 ..< 100))
+            .concat(Observable.never())
+            .debounce(.milliseconds(50), scheduler: scheduler)
+            .take(1)
+            .toBlocking(timeout: 2.0)
+
+        XCTAssertEqual(try result.first(), 99)
+    }
+}
+
+extension WorkStealingSchedulerTests {
+    func test_schedule() {
+        let expectScheduling = expectation(description: "wait")
+        expectScheduling.expectedFulfillmentCount = 1000
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+
+        for _ in 0 ..< 1000 {
+            _ = scheduler.schedule(()) { _ -> Disposable in
+                expectScheduling.fulfill()
+                return Disposables.create()
+            }
+        }
+
+        waitForExpectations(timeout: 5.0) { error in
+            XCTAssertNil(error)
+        }
+    }
+
+    func test_scheduleCancel() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = WorkStealingScheduler(workerCount: 2)
+        let gate = DispatchSemaphore(value: 0)
+        let fired = Synchronized([Int]())
+
+        // Keep both workers busy so the cancelled actions are still queued.
+        for _ in 0 ..< 2 {
+            _ = scheduler.schedule(()) { _ -> Disposable in
+                gate.wait()
+                return Disposables.create()
+            }
+        }
+
+        let disposable = scheduler.schedule(1) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            return Disposables.create()
+        }
+        _ = scheduler.schedule(2) { value -> Disposable in
+            fired.mutate { $0.append(value) }
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        disposable.dispose()
+        gate.signal()
+        gate.signal()
+
+        waitForExpectations(timeout: 2.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, [2])
+    }
+
+    func test_scheduleRunsExternalActionsInOrder() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = WorkStealingScheduler(workerCount: 1)
+        let gate = DispatchSemaphore(value: 0)
+        let fired = Synchronized([Int]())
+
+        _ = scheduler.schedule(()) { _ -> Disposable in
+            gate.wait()
+            return Disposables.create()
+        }
+
+        for i in 0 ..< 100 {
+            _ = scheduler.schedule(i) { value -> Disposable in
+                fired.mutate { $0.append(value) }
+                if value == 99 {
+                    expectScheduling.fulfill()
+                }
+                return Disposables.create()
+            }
+        }
+
+        gate.signal()
+
+        waitForExpectations(timeout: 2.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(fired.value, Array(0 ..< 100))
+    }
+
+    func test_scheduleRecursiveDoesntStarveExternalActions() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = WorkStealingScheduler(workerCount: 1)
+        let externalRan = Synchronized(false)
+        let started = DispatchSemaphore(value: 0)
+
+        _ = scheduler.scheduleRecursive(0) { count, recurse in
+            if count == 0 {
+                started.signal()
+            }
+            if !externalRan.value {
+                recurse(count + 1)
+            }
+        }
+
+        started.wait()
+
+        _ = scheduler.schedule(()) { _ -> Disposable in
+            externalRan.mutate { $0 = true }
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 2.0) { error in
+            XCTAssertNil(error)
+        }
+    }
+
+    func test_scheduleRecursiveStaysOnWorker() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = WorkStealingScheduler(workerCount: 4)
+        let threads = Synchronized(Set<String>())
+
+        _ = scheduler.scheduleRecursive(0) { count, recurse in
+            threads.mutate { $0.insert("\(Unmanaged.passUnretained(Thread.current).toOpaque())") }
+            if count == 100 {
+                expectScheduling.fulfill()
+            } else {
+                recurse(count + 1)
+            }
+        }
+
+        waitForExpectations(timeout: 2.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(threads.value.count, 1)
+    }
+
+    func test_scheduleRelative() {
+        let expectScheduling = expectation(description: "wait")
+        let scheduler = WorkStealingScheduler(workerCount: 2)
+        let start = Date()
+
+        var interval = 0.0
+
+        _ = scheduler.scheduleRelative(1, dueTime: .milliseconds(100)) { _ -> Disposable in
+            interval = Date().timeIntervalSince(start)
+            expectScheduling.fulfill()
+            return Disposables.create()
+        }
+
+        waitForExpectations(timeout: 1.0) { error in
+            XCTAssertNil(error)
+        }
+
+        XCTAssertEqual(interval, 0.1, accuracy: 0.1)
+    }
+}
@@ -236,4 +236,103 @@ extension VirtualSchedulerTest {
         times = times.sorted()
         XCTAssertEqual(times, ticks)
     }
+
+    func testVirtualScheduler_disposeAfterRunDoesntAffectLaterItems() {
+        let scheduler = TestVirtualScheduler()
+
+        var times: [Int] = []
+
+        let first = scheduler.scheduleRelative((), dueTime: .seconds(10)) { _ in
+            times.append(scheduler.clock)
+            return Disposables.create()
+        }
+
+        scheduler.start()
+
+        _ = scheduler.scheduleRelative((), dueTime: .seconds(10)) { _ in
+            times.append(scheduler.clock)
+            return Disposables.create()
+        }
+
+        first.dispose()
+        scheduler.start()
+
+        XCTAssertEqual(times, [
+            1,
+            2
+        ])
+    }
+
+    func testVirtualScheduler_disposeAfterRunDisposesActionResult() {
+        let scheduler = TestVirtualScheduler()
+
+        var isDisposed = false
+
+        let disposable = scheduler.scheduleRelative((), dueTime: .seconds(10)) { _ in
+            Disposables.create {
+                isDisposed = true
+            }
+        }
+
+        scheduler.start()
+        XCTAssertFalse(isDisposed)
+
+        disposable.dispose()
+        XCTAssertTrue(isDisposed)
+    }
+
+    func testVirtualScheduler_stressWithCancellation() {
+        let scheduler = TestVirtualScheduler()
+
+        var expected = [Int]()
+        var ticks = [Int]()
+        var disposables = [Disposable]()
+
+        for i in 0 ..< 100_000 {
+            let due = (i * 7919) % 10000
+            if i % 2 == 0 {
+                expected.append(due)
+            }
+            disposables.append(scheduler.scheduleRelative((), dueTime: .seconds(10 * due)) { [weak scheduler] _ in
+                ticks.append(scheduler!.clock)
+                return Disposables.create()
+            })
+        }
+
+        for (i, disposable) in disposables.enumerated() where i % 2 == 1 {
+            disposable.dispose()
+        }
+
+        scheduler.start()
+
+        XCTAssertEqual(ticks, expected.sorted())
+    }
+
+    func testVirtualScheduler_disposeFromAnotherThreadWhileRunning() {
+        let scheduler = TestVirtualScheduler()
+        let count = 10000
+
+        var ran = [Int]()
+
+        let disposables = (0 ..< count).map { i in
+            scheduler.scheduleRelative(i, dueTime: .seconds(10 * (i + 1))) { i in
+                ran.append(i)
+                return Disposables.create()
+            }
+        }
+
+        let disposed = DispatchSemaphore(value: 0)
+        DispatchQueue.global().async {
+            for disposable in disposables[(count / 2)...] {
+                disposable.dispose()
+            }
+            disposed.signal()
+        }
+
+        scheduler.start()
+        disposed.wait()
+
+        XCTAssertEqual(Array(ran.prefix(count / 2)), Array(0 ..< count / 2))
+        XCTAssertEqual(ran, Array(0 ..< ran.count))
+    }
 }
@@ -0,0 +1,22 @@
+set -e
+
+# Builds and runs the RxBenchmarks executable in release configuration.
+# All arguments are passed to it, e.g.
+#
+#   scripts/benchmarks.sh --json current.json --baseline baseline.json
+
+function cleanup {
+	git checkout Package.swift
+}
+
+if [[ `git diff HEAD Package.swift | wc -l` > 0 ]]; then
+	echo "Package.swift has uncommitted changes"
+	exit -1
+fi
+trap cleanup EXIT
+
+cat Package.swift | sed "s/let buildBenchmarks = false/let buildBenchmarks = true/" > Package.benchmarks.swift
+mv Package.benchmarks.swift Package.swift
+
+swift build -c release --product RxBenchmarks
+./.build/release/RxBenchmarks "$@"
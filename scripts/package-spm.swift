@@ -68,6 +68,7 @@ let excludedTestClasses: [String] = [
      "VirtualSchedulerTest",
      "HistoricalSchedulerTest" */
     "BagTest",
+    "ExecutorSchedulerTests",
     "SharedSequenceConcurrencyTests",
     "InfallibleConcurrencyTests",
     "ObservableConcurrencyTests",
@@ -44,8 +44,6 @@ let excludedRootPaths = [
 let excludePaths = [
     "AllTestz/main.swift",
     "Platform/AtomicInt.swift",
-    "Platform/Platform.Linux.swift",
-    "Platform/Platform.Darwin.swift",
     "Platform/RecursiveLock.swift",
     "Platform/DataStructures/Bag.swift",
     "Platform/DataStructures/InfiniteSequence.swift",